@@ -30,10 +30,28 @@ namespace uscp::memetic
 	{
 		position_serial stopping_criterion;
 		uscp::rwls::position_serial rwls_stopping_criterion;
+		bool prune_redundant = false;
+		std::string prune_order = "largest";
+		size_t population_size = 2;
+		size_t islands = 1;
+		size_t migration_interval = 10;
+		bool steady_state = false;
+		size_t outcomes_table_size = 0;
+		size_t target = 0;
 	};
 	void to_json(nlohmann::json& j, const config_serial& serial);
 	void from_json(const nlohmann::json& j, config_serial& serial);
 
+	struct operators_usage_serial final
+	{
+		std::string crossover_operator;
+		std::string wcrossover_operator;
+		size_t children = 0;
+		double mean_reward = 0;
+	};
+	void to_json(nlohmann::json& j, const operators_usage_serial& serial);
+	void from_json(const nlohmann::json& j, operators_usage_serial& serial);
+
 	struct report_serial final
 	{
 		solution_serial solution_final;
@@ -43,6 +61,8 @@ namespace uscp::memetic
 		config_serial solve_config;
 		std::string crossover_operator;
 		std::string wcrossover_operator;
+		bool target_reached = false;
+		std::vector<operators_usage_serial> operators_selection;
 	};
 	void to_json(nlohmann::json& j, const report_serial& serial);
 	void from_json(const nlohmann::json& j, report_serial& serial);
@@ -33,6 +33,8 @@ namespace uscp::rwls
 		position_serial found_at;
 		position_serial ended_at;
 		position_serial stopping_criterion;
+		size_t target = 0;
+		bool target_reached = false;
 	};
 	void to_json(nlohmann::json& j, const report_serial& serial);
 	void from_json(const nlohmann::json& j, report_serial& serial);
@@ -8,6 +8,8 @@
 #ifndef USCP_COMMON_INSTANCE_HPP
 #define USCP_COMMON_INSTANCE_HPP
 
+#include "common/data/sparse_rows.hpp"
+
 #include <dynamic_bitset.hpp>
 #include <nlohmann/json.hpp>
 
@@ -15,6 +17,7 @@
 #include <optional>
 #include <string>
 #include <cstddef>
+#include <cstdint>
 #include <ostream>
 #include <string_view>
 #include <vector>
@@ -42,6 +45,7 @@ namespace uscp::problem
 		size_t points_number = 0;
 		size_t subsets_number = 0;
 		std::vector<size_t> points_covered;
+		std::vector<size_t> points_dominated;
 		std::vector<size_t> subsets_dominated;
 		std::vector<size_t> subsets_included;
 
@@ -58,6 +62,7 @@ namespace uscp::problem
 	{
 		// relative to full solution
 		dynamic_bitset<> points_covered;
+		dynamic_bitset<> points_dominated; // covered by any cover of a remaining point
 		dynamic_bitset<> subsets_dominated;
 		dynamic_bitset<> subsets_included;
 
@@ -84,13 +89,19 @@ namespace uscp::problem
 		reduction_info& operator=(reduction_info&&) noexcept = default;
 	};
 
+	// The dense subsets points are only built for instances with at most this number of bits
+	static constexpr size_t DENSE_MAX_BITS = size_t(1) << 27;
+
 	struct instance final
 	{
 		std::optional<reduction_info> reduction;
 		std::string name;
 		size_t points_number = 0;
 		size_t subsets_number = 0;
-		std::vector<dynamic_bitset<>> subsets_points;
+		sparse_rows subsets_points_csr; // sorted points of each subset
+		sparse_rows points_subsets_csr; // sorted subsets covering each point
+		std::vector<dynamic_bitset<>> subsets_points; // dense form, empty for large instances
+		uint64_t content_fingerprint = 0; // fingerprint(), computed when the content is set
 
 		explicit instance(std::optional<reduction_info> reduction = {}) noexcept;
 		instance(const instance&) = default;
@@ -104,6 +115,33 @@ namespace uscp::problem
 	void to_json(nlohmann::json& j, const instance& instance);
 	std::ostream& operator<<(std::ostream& os, const instance& instance);
 
+	// Set the instance content (and its fingerprint) from the sorted points of each subset, without
+	// duplicates, the dense form is only built if dense_form (and the instance is small enough)
+	void set_subsets_points(instance& instance,
+	                        size_t points_number,
+	                        sparse_rows subsets_points,
+	                        bool dense_form = true) noexcept;
+	void set_subsets_points(instance& instance,
+	                        size_t points_number,
+	                        sparse_rows subsets_points,
+	                        sparse_rows points_subsets,
+	                        bool dense_form = true) noexcept;
+
+	// Set the instance content from the subsets covering each point, in any order
+	void set_points_subsets(instance& instance,
+	                        size_t subsets_number,
+	                        const sparse_rows& points_subsets) noexcept;
+
+	// points |= points of subset, with the dense form when available
+	void add_subset_points(const instance& instance,
+	                       size_t subset,
+	                       dynamic_bitset<>& points) noexcept;
+
+	// Hash of the instance content (sizes and subsets points), independent of the name and reduction
+	[[nodiscard]] uint64_t fingerprint(const instance& instance) noexcept;
+	[[nodiscard]] uint64_t fingerprint(size_t points_number,
+	                                   const sparse_rows& subsets_points) noexcept;
+
 	struct instance_info final
 	{
 		std::string_view file; // std::filesystem::path is not constexpr
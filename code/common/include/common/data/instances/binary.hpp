@@ -0,0 +1,45 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#ifndef USCP_BINARY_HPP
+#define USCP_BINARY_HPP
+
+#include "common/data/instance.hpp"
+
+#include <filesystem>
+
+// Binary instances converted from the registered instances, see binary::instance_path
+#define BINARY_INSTANCES_FOLDER "./resources/binary/"
+
+namespace uscp::problem::binary
+{
+	// Memory-mapped instance: the sparse rows are used in place from the file
+	bool read(const std::filesystem::path& path, uscp::problem::instance& instance) noexcept;
+
+	// source_path: file the instance was read from, its size and modification time are stored to
+	// detect outdated binary files, see is_up_to_date
+	bool write(const uscp::problem::instance& instance,
+	           const std::filesystem::path& path,
+	           bool override_file = false,
+	           const std::filesystem::path& source_path = {}) noexcept;
+
+	// Write sorted rows without building an instance (no dense rows)
+	bool write(const sparse_rows& subsets_points,
+	           const sparse_rows& points_subsets,
+	           const std::filesystem::path& path,
+	           bool override_file = false,
+	           const std::filesystem::path& source_path = {}) noexcept;
+
+	// Binary file converted from source_path still matches it, true if source_path doesn't exist
+	[[nodiscard]] bool is_up_to_date(const std::filesystem::path& path,
+	                                 const std::filesystem::path& source_path) noexcept;
+
+	// Binary file of a registered instance
+	[[nodiscard]] std::filesystem::path instance_path(const instance_info& info) noexcept;
+} // namespace uscp::problem::binary
+
+#endif //USCP_BINARY_HPP
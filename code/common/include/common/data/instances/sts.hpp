@@ -45,6 +45,12 @@ namespace uscp::problem::sts
 	bool write(const uscp::problem::instance& instance,
 	           const std::filesystem::path& path,
 	           bool override_file = false) noexcept;
+
+	// Steiner triple system of order 6n+3 built in memory, with the layout of read. STS(3^k) and
+	// STS(15 * 3^k) are triplings of STS(3) and of the Bose STS(15), like the registered instances
+	// (same instances up to the points and subsets numbering), other orders use the Bose
+	// construction
+	bool generate(size_t order, uscp::problem::instance& instance) noexcept;
 } // namespace uscp::problem::sts
 
 #endif //USCP_STS_HPP
@@ -14,6 +14,7 @@
 #include <nlohmann/json.hpp>
 
 #include <cstddef>
+#include <cstdint>
 #include <vector>
 #include <ostream>
 
@@ -47,6 +48,17 @@ namespace uscp
 	};
 	void to_json(nlohmann::json& j, const solution& solution);
 	std::ostream& operator<<(std::ostream& os, const solution& solution);
+
+	// Key of a subset in solution hashes (SplitMix64 finalizer), a solution hash is the XOR of its
+	// selected subsets keys: adding or removing a subset updates it in O(1)
+	[[nodiscard]] constexpr uint64_t subset_hash(size_t subset) noexcept
+	{
+		uint64_t key = static_cast<uint64_t>(subset) + 0x9e3779b97f4a7c15;
+		key = (key ^ (key >> 30)) * 0xbf58476d1ce4e5b9;
+		key = (key ^ (key >> 27)) * 0x94d049bb133111eb;
+		return key ^ (key >> 31);
+	}
+	[[nodiscard]] uint64_t solution_hash(const solution& solution) noexcept;
 } // namespace uscp
 
 #endif //USCP_COMMON_SOLUTION_HPP
@@ -0,0 +1,126 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#ifndef USCP_SPARSE_ROWS_HPP
+#define USCP_SPARSE_ROWS_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <ostream>
+#include <vector>
+
+namespace uscp::problem
+{
+	// Compressed sparse rows (CSR): the indexes of row i are indexes[offsets[i]..offsets[i + 1]),
+	// the storage is immutable and shared between copies
+	class sparse_rows final
+	{
+	public:
+		using index_type = uint32_t;
+		using offset_type = uint64_t;
+		static constexpr size_t MAX_INDEX = std::numeric_limits<index_type>::max();
+
+		struct row_view final
+		{
+			const index_type* first;
+			const index_type* last;
+
+			[[nodiscard]] const index_type* begin() const noexcept
+			{
+				return first;
+			}
+			[[nodiscard]] const index_type* end() const noexcept
+			{
+				return last;
+			}
+			[[nodiscard]] size_t size() const noexcept
+			{
+				return static_cast<size_t>(last - first);
+			}
+			[[nodiscard]] bool empty() const noexcept
+			{
+				return first == last;
+			}
+			[[nodiscard]] index_type operator[](size_t i) const noexcept
+			{
+				assert(i < size());
+				return first[i];
+			}
+		};
+
+		sparse_rows() noexcept;
+		// offsets: rows number + 1 values starting at 0
+		sparse_rows(std::vector<offset_type> offsets, std::vector<index_type> indexes) noexcept;
+		// view on external storage kept alive by storage (memory-mapped file...)
+		sparse_rows(std::shared_ptr<const void> storage,
+		            const offset_type* offsets,
+		            const index_type* indexes,
+		            size_t rows_number) noexcept;
+		sparse_rows(const sparse_rows&) = default;
+		sparse_rows(sparse_rows&&) noexcept = default;
+		sparse_rows& operator=(const sparse_rows&) = default;
+		sparse_rows& operator=(sparse_rows&&) noexcept = default;
+
+		[[nodiscard]] size_t rows_number() const noexcept
+		{
+			return m_rows_number;
+		}
+		[[nodiscard]] size_t indexes_number() const noexcept
+		{
+			return static_cast<size_t>(m_offsets[m_rows_number]);
+		}
+		[[nodiscard]] const offset_type* offsets() const noexcept
+		{
+			return m_offsets;
+		}
+		[[nodiscard]] const index_type* indexes() const noexcept
+		{
+			return m_indexes;
+		}
+
+		[[nodiscard]] row_view operator[](size_t row) const noexcept
+		{
+			assert(row < m_rows_number);
+			return {m_indexes + m_offsets[row], m_indexes + m_offsets[row + 1]};
+		}
+
+		// rows must be sorted
+		[[nodiscard]] bool contains(size_t row, size_t index) const noexcept;
+
+	private:
+		std::shared_ptr<const void> m_storage;
+		const offset_type* m_offsets;
+		const index_type* m_indexes;
+		size_t m_rows_number;
+	};
+
+	// Rows of the transposed matrix, sorted, with columns_number rows
+	[[nodiscard]] sparse_rows transpose(const sparse_rows& rows, size_t columns_number) noexcept;
+
+	// Sort the rows and remove duplicated indexes
+	[[nodiscard]] sparse_rows normalize(const sparse_rows& rows, size_t columns_number) noexcept;
+
+	// true if all the indexes of the sorted range [first, last) are in the sorted row
+	[[nodiscard]] bool is_subset_of(const sparse_rows::index_type* first,
+	                                const sparse_rows::index_type* last,
+	                                sparse_rows::row_view row) noexcept;
+
+	// true if the offsets are increasing from 0 and the rows are sorted without duplicates, with
+	// indexes lower than columns_number (for rows viewed from untrusted storage, the last offset
+	// must have been checked against the storage size)
+	[[nodiscard]] bool is_valid(const sparse_rows& rows, size_t columns_number) noexcept;
+
+	// Binary layout: rows number + 1 offsets, then the indexes padded with zeros to 64 bits words
+	[[nodiscard]] size_t indexes_words_number(size_t indexes_number) noexcept;
+	void write_offsets(std::ostream& stream, const sparse_rows& rows) noexcept;
+	void write_indexes(std::ostream& stream, const sparse_rows& rows) noexcept;
+} // namespace uscp::problem
+
+#endif //USCP_SPARSE_ROWS_HPP
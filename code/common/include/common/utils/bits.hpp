@@ -0,0 +1,101 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#ifndef USCP_BITS_HPP
+#define USCP_BITS_HPP
+
+#include <dynamic_bitset.hpp>
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__BMI2__) || (defined(_MSC_VER) && defined(__AVX2__))
+#	include <immintrin.h>
+#	define USCP_BITS_BMI2 1
+#endif
+#if defined(_MSC_VER) && !defined(__clang__)
+#	include <intrin.h>
+#endif
+
+namespace uscp
+{
+	using block_type = dynamic_bitset<>::block_type;
+	static_assert(dynamic_bitset<>::bits_per_block == 64, "64 bits blocks expected");
+
+	[[nodiscard]] inline size_t popcount(uint64_t value) noexcept
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		return static_cast<size_t>(__builtin_popcountll(value));
+#elif defined(_MSC_VER) && defined(_M_X64)
+		return static_cast<size_t>(__popcnt64(value));
+#else
+		size_t count = 0;
+		for(; value != 0; value &= value - 1)
+		{
+			++count;
+		}
+		return count;
+#endif
+	}
+
+	// Scatter the low bits of value to the positions selected by mask (BMI2 PDEP)
+	[[nodiscard]] inline uint64_t deposit_bits(uint64_t value, uint64_t mask) noexcept
+	{
+#if defined(USCP_BITS_BMI2)
+		return _pdep_u64(value, mask);
+#else
+		uint64_t result = 0;
+		for(uint64_t bit = 1; mask != 0; bit <<= 1)
+		{
+			const uint64_t lowest = mask & (~mask + 1);
+			if(value & bit)
+			{
+				result |= lowest;
+			}
+			mask ^= lowest;
+		}
+		return result;
+#endif
+	}
+
+	// destination = bits of source scattered to the positions selected by mask, other bits reset
+	// (source size: mask.count(), destination size: mask.size())
+	inline void expand_bits(const dynamic_bitset<>& source,
+	                        const dynamic_bitset<>& mask,
+	                        dynamic_bitset<>& destination) noexcept
+	{
+		assert(source.size() == mask.count());
+		assert(destination.size() == mask.size());
+		const block_type* source_blocks = source.data();
+		const block_type* mask_blocks = mask.data();
+		block_type* destination_blocks = destination.data();
+
+		size_t offset = 0;
+		for(size_t i_block = 0; i_block < mask.num_blocks(); ++i_block)
+		{
+			const block_type mask_block = mask_blocks[i_block];
+			if(mask_block == 0)
+			{
+				destination_blocks[i_block] = 0;
+				continue;
+			}
+			const size_t bits_number = popcount(mask_block);
+			const size_t shift = offset % 64;
+			block_type bits = source_blocks[offset / 64] >> shift;
+			if(shift + bits_number > 64)
+			{
+				bits |= source_blocks[offset / 64 + 1] << (64 - shift);
+			}
+			destination_blocks[i_block] = deposit_bits(bits, mask_block);
+			offset += bits_number;
+		}
+		assert(offset == source.size());
+	}
+} // namespace uscp
+
+#endif //USCP_BITS_HPP
@@ -0,0 +1,52 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#ifndef USCP_FILE_HPP
+#define USCP_FILE_HPP
+
+#include <filesystem>
+#include <functional>
+#include <ostream>
+#include <cstddef>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#	define USCP_MAPPED_FILE_MMAP 1
+#endif
+
+// Read-only view of a whole file, memory-mapped when the platform allows it, read otherwise
+class mapped_file final
+{
+public:
+	mapped_file() noexcept;
+	mapped_file(const mapped_file&) = delete;
+	mapped_file(mapped_file&& other) noexcept;
+	mapped_file& operator=(const mapped_file& other) = delete;
+	mapped_file& operator=(mapped_file&& other) noexcept;
+	~mapped_file() noexcept;
+
+	[[nodiscard]] bool open(const std::filesystem::path& path) noexcept;
+	void close() noexcept;
+
+	[[nodiscard]] bool is_open() const noexcept;
+	[[nodiscard]] const std::byte* data() const noexcept;
+	[[nodiscard]] size_t size() const noexcept;
+
+private:
+	const std::byte* m_data;
+	size_t m_size;
+#if !defined(USCP_MAPPED_FILE_MMAP)
+	std::vector<std::byte> m_buffer;
+#endif
+};
+
+// Write a file with writer through a temporary file renamed at the end: readers of path never see a
+// partially written file
+[[nodiscard]] bool write_file_atomically(const std::filesystem::path& path,
+                                         const std::function<bool(std::ostream&)>& writer) noexcept;
+
+#endif //USCP_FILE_HPP
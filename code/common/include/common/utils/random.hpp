@@ -8,11 +8,32 @@
 #ifndef USCP_COMMON_RANDOM_HPP
 #define USCP_COMMON_RANDOM_HPP
 
+#include <cstdint>
 #include <random>
 
 namespace uscp
 {
 	using random_engine = std::mt19937;
-}
+
+	// Independent random streams derived from a seed: a stream only depends on the seed and on its
+	// index, parallel tasks using their own stream are reproducible whatever the threads number
+	class random_streams final
+	{
+	public:
+		explicit random_streams(uint64_t seed) noexcept;
+		explicit random_streams(random_engine& generator) noexcept;
+		random_streams(const random_streams&) = default;
+		random_streams(random_streams&&) noexcept = default;
+		random_streams& operator=(const random_streams& other) = default;
+		random_streams& operator=(random_streams&& other) noexcept = default;
+
+		[[nodiscard]] random_engine stream(uint64_t index) const noexcept;
+		[[nodiscard]] random_streams split(uint64_t index) const noexcept;
+		[[nodiscard]] uint64_t seed() const noexcept;
+
+	private:
+		uint64_t m_seed;
+	};
+} // namespace uscp
 
 #endif //USCP_COMMON_RANDOM_HPP
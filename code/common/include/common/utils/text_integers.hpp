@@ -0,0 +1,55 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#ifndef USCP_TEXT_INTEGERS_HPP
+#define USCP_TEXT_INTEGERS_HPP
+
+#include <filesystem>
+#include <string_view>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Unsigned integers of a text separated by whitespaces, parsed with std::from_chars by chunks (in
+// parallel with OpenMP). Like extractions from a stream, parsing stops at the first invalid value.
+// Values are stored on 32 bits, as instances indexes: a larger value is invalid.
+class text_integers final
+{
+public:
+	text_integers() noexcept;
+	text_integers(const text_integers&) = default;
+	text_integers(text_integers&&) noexcept = default;
+	text_integers& operator=(const text_integers& other) = default;
+	text_integers& operator=(text_integers&& other) noexcept = default;
+
+	// false if the file cannot be read (mapped, see mapped_file)
+	[[nodiscard]] bool open(const std::filesystem::path& path) noexcept;
+	void parse(std::string_view text) noexcept;
+
+	// false after the last integer
+	[[nodiscard]] bool next(size_t& value) noexcept
+	{
+		while(m_position == m_chunks[m_chunk].size())
+		{
+			if(m_chunk + 1 == m_chunks.size())
+			{
+				return false;
+			}
+			++m_chunk;
+			m_position = 0;
+		}
+		value = m_chunks[m_chunk][m_position++];
+		return true;
+	}
+
+private:
+	std::vector<std::vector<uint32_t>> m_chunks;
+	size_t m_chunk;
+	size_t m_position;
+};
+
+#endif //USCP_TEXT_INTEGERS_HPP
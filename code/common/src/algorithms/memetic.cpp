@@ -28,6 +28,14 @@ void uscp::memetic::to_json(nlohmann::json& j, const uscp::memetic::config_seria
 	j = nlohmann::json{
 	  {"stopping_criterion", serial.stopping_criterion},
 	  {"rwls_stopping_criterion", serial.rwls_stopping_criterion},
+	  {"prune_redundant", serial.prune_redundant},
+	  {"prune_order", serial.prune_order},
+	  {"population_size", serial.population_size},
+	  {"islands", serial.islands},
+	  {"migration_interval", serial.migration_interval},
+	  {"steady_state", serial.steady_state},
+	  {"outcomes_table_size", serial.outcomes_table_size},
+	  {"target", serial.target},
 	};
 }
 
@@ -35,6 +43,39 @@ void uscp::memetic::from_json(const nlohmann::json& j, uscp::memetic::config_ser
 {
 	j.at("stopping_criterion").get_to(serial.stopping_criterion);
 	j.at("rwls_stopping_criterion").get_to(serial.rwls_stopping_criterion);
+
+	// support for versions without redundancy pruning
+	serial.prune_redundant = j.value<bool>("prune_redundant", false);
+	serial.prune_order = j.value<std::string>("prune_order", "largest");
+
+	// support for versions with a single population of two individuals
+	serial.population_size = j.value<size_t>("population_size", 2);
+	serial.islands = j.value<size_t>("islands", 1);
+	serial.migration_interval = j.value<size_t>("migration_interval", 10);
+	serial.steady_state = j.value<bool>("steady_state", false);
+	serial.outcomes_table_size = j.value<size_t>("outcomes_table_size", 0);
+
+	// support for versions without stopping target
+	serial.target = j.value<size_t>("target", 0);
+}
+
+void uscp::memetic::to_json(nlohmann::json& j, const uscp::memetic::operators_usage_serial& serial)
+{
+	j = nlohmann::json{
+	  {"crossover_operator", serial.crossover_operator},
+	  {"wcrossover_operator", serial.wcrossover_operator},
+	  {"children", serial.children},
+	  {"mean_reward", serial.mean_reward},
+	};
+}
+
+void uscp::memetic::from_json(const nlohmann::json& j,
+                              uscp::memetic::operators_usage_serial& serial)
+{
+	j.at("crossover_operator").get_to(serial.crossover_operator);
+	j.at("wcrossover_operator").get_to(serial.wcrossover_operator);
+	j.at("children").get_to(serial.children);
+	j.at("mean_reward").get_to(serial.mean_reward);
 }
 
 void uscp::memetic::to_json(nlohmann::json& j, const uscp::memetic::report_serial& serial)
@@ -47,6 +88,8 @@ void uscp::memetic::to_json(nlohmann::json& j, const uscp::memetic::report_seria
 	  {"solve_config", serial.solve_config},
 	  {"crossover_operator", serial.crossover_operator},
 	  {"wcrossover_operator", serial.wcrossover_operator},
+	  {"target_reached", serial.target_reached},
+	  {"operators_selection", serial.operators_selection},
 	};
 }
 
@@ -61,4 +104,11 @@ void uscp::memetic::from_json(const nlohmann::json& j, uscp::memetic::report_ser
 	// support for versions after de859b75cec4bb457af200479b4deb071df256e9
 	serial.points_weights_final = j.value<std::vector<long long>>("points_weights_final", {});
 	serial.wcrossover_operator = j.value<std::string>("wcrossover_operator", {});
+
+	// support for versions without stopping target
+	serial.target_reached = j.value<bool>("target_reached", false);
+
+	// support for versions without adaptive operators selection
+	serial.operators_selection =
+	  j.value<std::vector<operators_usage_serial>>("operators_selection", {});
 }
@@ -31,6 +31,8 @@ void uscp::rwls::to_json(nlohmann::json& j, const uscp::rwls::report_serial& ser
 	  {"found_at", serial.found_at},
 	  {"ended_at", serial.ended_at},
 	  {"stopping_criterion", serial.stopping_criterion},
+	  {"target", serial.target},
+	  {"target_reached", serial.target_reached},
 	};
 }
 
@@ -51,4 +53,8 @@ void uscp::rwls::from_json(const nlohmann::json& j, uscp::rwls::report_serial& s
 	// support for versions after 3a02851fe586fd37329ebd5309e9d92ba5d76dfc
 	serial.points_weights_initial = j.value<std::vector<long long>>("points_weights_initial", {});
 	serial.points_weights_final = j.value<std::vector<long long>>("points_weights_final", {});
+
+	// support for versions without stopping target
+	serial.target = j.value<size_t>("target", 0);
+	serial.target_reached = j.value<bool>("target_reached", false);
 }
@@ -11,6 +11,7 @@
 
 #include <utility>
 #include <cassert>
+#include <cstdint>
 
 void uscp::problem::to_json(nlohmann::json& j, const uscp::problem::instance_serial& serial)
 {
@@ -34,6 +35,7 @@ void uscp::problem::to_json(nlohmann::json& j, const uscp::problem::reduction_se
 	  {"points_number", serial.points_number},
 	  {"subsets_number", serial.subsets_number},
 	  {"points_covered", serial.points_covered},
+	  {"points_dominated", serial.points_dominated},
 	  {"subsets_dominated", serial.subsets_dominated},
 	  {"subsets_included", serial.subsets_included},
 	};
@@ -44,6 +46,8 @@ void uscp::problem::from_json(const nlohmann::json& j, uscp::problem::reduction_
 	j.at("points_number").get_to(serial.points_number);
 	j.at("subsets_number").get_to(serial.subsets_number);
 	j.at("points_covered").get_to(serial.points_covered);
+	// support for versions without row domination
+	serial.points_dominated = j.value<std::vector<size_t>>("points_dominated", {});
 	j.at("subsets_dominated").get_to(serial.subsets_dominated);
 	j.at("subsets_included").get_to(serial.subsets_included);
 }
@@ -58,6 +62,10 @@ uscp::problem::reduction_serial uscp::problem::reduction::serialize() const noex
 	serial.points_covered.reserve(points_covered.count());
 	points_covered.iterate_bits_on([&](size_t bit_on) { serial.points_covered.push_back(bit_on); });
 
+	serial.points_dominated.reserve(points_dominated.count());
+	points_dominated.iterate_bits_on(
+	  [&](size_t bit_on) { serial.points_dominated.push_back(bit_on); });
+
 	serial.subsets_dominated.reserve(subsets_dominated.count());
 	subsets_dominated.iterate_bits_on(
 	  [&](size_t bit_on) { serial.subsets_dominated.push_back(bit_on); });
@@ -77,6 +85,13 @@ bool uscp::problem::reduction::load(const uscp::problem::reduction_serial& seria
 		points_covered.set(point);
 	}
 
+	points_dominated.resize(serial.points_number);
+	points_dominated.reset();
+	for(size_t point: serial.points_dominated)
+	{
+		points_dominated.set(point);
+	}
+
 	subsets_dominated.resize(serial.subsets_number);
 	subsets_dominated.reset();
 	for(size_t subset: serial.subsets_dominated)
@@ -96,6 +111,7 @@ bool uscp::problem::reduction::load(const uscp::problem::reduction_serial& seria
 
 uscp::problem::reduction::reduction(size_t points_number, size_t subsets_number) noexcept
   : points_covered(points_number)
+  , points_dominated(points_number)
   , subsets_dominated(subsets_number)
   , subsets_included(subsets_number)
 {
@@ -126,7 +142,13 @@ uscp::problem::instance_serial uscp::problem::instance::serialize() const noexce
 }
 
 uscp::problem::instance::instance(std::optional<reduction_info> reduction_) noexcept
-  : reduction(std::move(reduction_)), name(), points_number(), subsets_number(), subsets_points()
+  : reduction(std::move(reduction_))
+  , name()
+  , points_number()
+  , subsets_number()
+  , subsets_points_csr()
+  , points_subsets_csr()
+  , subsets_points()
 {
 }
 
@@ -137,9 +159,15 @@ void uscp::problem::to_json(nlohmann::json& j, const uscp::problem::instance& in
 	json["name"] = instance.name;
 	json["points_number"] = instance.points_number;
 	json["subsets_number"] = instance.subsets_number;
-	for(size_t i = 0; i < instance.subsets_points.size(); ++i)
+	for(size_t i = 0; i < instance.subsets_number; ++i)
 	{
-		json["subsets_points"][i] = instance.subsets_points[i].to_string();
+		std::string subset_points(instance.points_number, '0');
+		for(sparse_rows::index_type point: instance.subsets_points_csr[i])
+		{
+			// same order as dynamic_bitset::to_string: most significant bit first
+			subset_points[instance.points_number - 1 - point] = '1';
+		}
+		json["subsets_points"][i] = std::move(subset_points);
 	}
 	j = std::move(json);
 }
@@ -151,6 +179,113 @@ std::ostream& uscp::problem::operator<<(std::ostream& os, const uscp::problem::i
 	return os;
 }
 
+void uscp::problem::set_subsets_points(uscp::problem::instance& instance,
+                                       size_t points_number,
+                                       uscp::problem::sparse_rows subsets_points,
+                                       bool dense_form) noexcept
+{
+	sparse_rows points_subsets = transpose(subsets_points, points_number);
+	set_subsets_points(
+	  instance, points_number, std::move(subsets_points), std::move(points_subsets), dense_form);
+}
+
+void uscp::problem::set_subsets_points(uscp::problem::instance& instance,
+                                       size_t points_number,
+                                       uscp::problem::sparse_rows subsets_points,
+                                       uscp::problem::sparse_rows points_subsets,
+                                       bool dense_form) noexcept
+{
+	assert(points_subsets.rows_number() == points_number);
+	assert(points_subsets.indexes_number() == subsets_points.indexes_number());
+	instance.points_number = points_number;
+	instance.subsets_number = subsets_points.rows_number();
+	instance.subsets_points_csr = std::move(subsets_points);
+	instance.points_subsets_csr = std::move(points_subsets);
+	instance.content_fingerprint = fingerprint(instance);
+
+	instance.subsets_points.clear();
+	if(dense_form && instance.subsets_number > 0
+	   && instance.points_number <= DENSE_MAX_BITS / instance.subsets_number)
+	{
+		instance.subsets_points.resize(instance.subsets_number,
+		                               dynamic_bitset<>(instance.points_number));
+		for(size_t i_subset = 0; i_subset < instance.subsets_number; ++i_subset)
+		{
+			for(sparse_rows::index_type point: instance.subsets_points_csr[i_subset])
+			{
+				instance.subsets_points[i_subset].set(point);
+			}
+		}
+	}
+}
+
+void uscp::problem::set_points_subsets(uscp::problem::instance& instance,
+                                       size_t subsets_number,
+                                       const uscp::problem::sparse_rows& points_subsets) noexcept
+{
+	// normalize through the transposition to get the sorted subsets rows without duplicates
+	const size_t points_number = points_subsets.rows_number();
+	sparse_rows subsets_points =
+	  normalize(transpose(points_subsets, subsets_number), points_number);
+	set_subsets_points(instance, points_number, std::move(subsets_points));
+}
+
+void uscp::problem::add_subset_points(const uscp::problem::instance& instance,
+                                      size_t subset,
+                                      dynamic_bitset<>& points) noexcept
+{
+	assert(subset < instance.subsets_number);
+	assert(points.size() == instance.points_number);
+	if(!instance.subsets_points.empty())
+	{
+		points |= instance.subsets_points[subset];
+		return;
+	}
+	for(sparse_rows::index_type point: instance.subsets_points_csr[subset])
+	{
+		points.set(point);
+	}
+}
+
+namespace
+{
+	// splitmix64 finalizer
+	[[nodiscard]] constexpr uint64_t mix(uint64_t value) noexcept
+	{
+		value += 0x9E3779B97F4A7C15;
+		value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9;
+		value = (value ^ (value >> 27)) * 0x94D049BB133111EB;
+		return value ^ (value >> 31);
+	}
+
+	[[nodiscard]] constexpr uint64_t combine(uint64_t hash, uint64_t value) noexcept
+	{
+		return mix(hash ^ mix(value));
+	}
+} // namespace
+
+uint64_t uscp::problem::fingerprint(const uscp::problem::instance& instance) noexcept
+{
+	return fingerprint(instance.points_number, instance.subsets_points_csr);
+}
+
+uint64_t uscp::problem::fingerprint(size_t points_number,
+                                    const uscp::problem::sparse_rows& subsets_points) noexcept
+{
+	uint64_t hash = combine(0, points_number);
+	hash = combine(hash, subsets_points.rows_number());
+	for(size_t i_subset = 0; i_subset < subsets_points.rows_number(); ++i_subset)
+	{
+		for(sparse_rows::index_type point: subsets_points[i_subset])
+		{
+			hash = combine(hash, point);
+		}
+		// subsets separator
+		hash = combine(hash, points_number);
+	}
+	return hash;
+}
+
 void uscp::problem::to_json(nlohmann::json& j, const uscp::problem::instance_info& instance)
 {
 	nlohmann::json json;
@@ -0,0 +1,293 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#include "common/data/instances/binary.hpp"
+#include "common/utils/logger.hpp"
+#include "common/utils/timer.hpp"
+#include "common/utils/file.hpp"
+
+#include <cassert>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace
+{
+	// Binary instance file, native endianness, made of 64 bits words:
+	// - header: magic, version, content fingerprint, points, subsets and covering numbers,
+	//   source file size and modification time (0 without source file)
+	// - sparse rows offsets: subsets points, points subsets
+	// - sparse rows indexes (32 bits, padded to a word): subsets points, points subsets
+	constexpr uint64_t BINARY_INSTANCE_MAGIC = 0x31534E4950435355; // "USCPINS1"
+	constexpr uint64_t BINARY_INSTANCE_VERSION = 2;
+	constexpr size_t BINARY_INSTANCE_HEADER_SIZE = 8;
+
+	struct source_stamp final
+	{
+		uint64_t size = 0;
+		uint64_t time = 0;
+	};
+
+	bool read_source_stamp(const std::filesystem::path& source_path, source_stamp& stamp) noexcept
+	{
+		std::error_code error;
+		const uintmax_t size = std::filesystem::file_size(source_path, error);
+		if(error)
+		{
+			SPDLOG_LOGGER_DEBUG(LOGGER, "std::filesystem::file_size failed: {}", error.message());
+			return false;
+		}
+		const std::filesystem::file_time_type time =
+		  std::filesystem::last_write_time(source_path, error);
+		if(error)
+		{
+			SPDLOG_LOGGER_DEBUG(
+			  LOGGER, "std::filesystem::last_write_time failed: {}", error.message());
+			return false;
+		}
+		stamp.size = static_cast<uint64_t>(size);
+		stamp.time = static_cast<uint64_t>(time.time_since_epoch().count());
+		return true;
+	}
+
+	bool write_rows(uint64_t content_fingerprint,
+	                const uscp::problem::sparse_rows& subsets_points,
+	                const uscp::problem::sparse_rows& points_subsets,
+	                const std::filesystem::path& path,
+	                bool override_file,
+	                const std::filesystem::path& source_path) noexcept
+	{
+		const timer timer;
+
+		source_stamp stamp;
+		if(!source_path.empty() && !read_source_stamp(source_path, stamp))
+		{
+			LOGGER->warn("Failed to get size and modification time of {}", source_path);
+			return false;
+		}
+
+		std::error_code error;
+		if(std::filesystem::exists(path, error))
+		{
+			if(error)
+			{
+				SPDLOG_LOGGER_DEBUG(LOGGER, "std::filesystem::exists failed: {}", error.message());
+				LOGGER->warn("Check if file/folder exist failed for {}", path);
+			}
+			else if(!override_file)
+			{
+				LOGGER->warn("Tried to write problem instance to already-existing file/folder {}",
+				             path);
+				return false;
+			}
+		}
+
+		LOGGER->info("Started to write problem instance to file {}", path);
+		const bool written = write_file_atomically(path, [&](std::ostream& stream) noexcept {
+			const uint64_t header[BINARY_INSTANCE_HEADER_SIZE] = {
+			  BINARY_INSTANCE_MAGIC,
+			  BINARY_INSTANCE_VERSION,
+			  content_fingerprint,
+			  points_subsets.rows_number(),
+			  subsets_points.rows_number(),
+			  subsets_points.indexes_number(),
+			  stamp.size,
+			  stamp.time};
+			stream.write(reinterpret_cast<const char*>(header), sizeof(header));
+			uscp::problem::write_offsets(stream, subsets_points);
+			uscp::problem::write_offsets(stream, points_subsets);
+			uscp::problem::write_indexes(stream, subsets_points);
+			uscp::problem::write_indexes(stream, points_subsets);
+			return static_cast<bool>(stream);
+		});
+		if(!written)
+		{
+			LOGGER->warn("Error writing to file");
+			return false;
+		}
+
+		// Success
+		LOGGER->info("successfully written problem instance in {}s", timer.elapsed());
+
+		return true;
+	}
+} // namespace
+
+bool uscp::problem::binary::read(const std::filesystem::path& path,
+                                 uscp::problem::instance& instance_out) noexcept
+{
+	instance_out.subsets_number = 0;
+	instance_out.points_number = 0;
+	instance_out.subsets_points_csr = {};
+	instance_out.points_subsets_csr = {};
+	instance_out.subsets_points.clear();
+	instance_out.content_fingerprint = 0;
+	const timer timer;
+
+	std::error_code error;
+	if(!std::filesystem::is_regular_file(path, error))
+	{
+		if(error)
+		{
+			SPDLOG_LOGGER_DEBUG(
+			  LOGGER, "std::filesystem::is_regular_file failed: {}", error.message());
+			LOGGER->warn("Check if path is a regular file failed for: {}", path);
+		}
+		else
+		{
+			LOGGER->warn("Tried to read problem instance from non-file {}", path);
+		}
+		return false;
+	}
+
+	// shared with the rows of the instance
+	const std::shared_ptr<mapped_file> file = std::make_shared<mapped_file>();
+	if(!file->open(path))
+	{
+		LOGGER->warn("Failed to read file {}", path);
+		return false;
+	}
+
+	LOGGER->info("Started to read problem instance from file {}", path);
+	const size_t words_number = file->size() / sizeof(uint64_t);
+	if(file->size() % sizeof(uint64_t) != 0 || words_number < BINARY_INSTANCE_HEADER_SIZE)
+	{
+		LOGGER->warn("Invalid file format");
+		return false;
+	}
+	const uint64_t* header = reinterpret_cast<const uint64_t*>(file->data());
+	if(header[0] != BINARY_INSTANCE_MAGIC)
+	{
+		LOGGER->warn("Invalid file format");
+		return false;
+	}
+	if(header[1] != BINARY_INSTANCE_VERSION)
+	{
+		LOGGER->warn("Unsupported binary instance version: {}", header[1]);
+		return false;
+	}
+	const size_t points_number = header[3];
+	const size_t subsets_number = header[4];
+	const size_t covering_number = header[5];
+	if(points_number == 0 || points_number > sparse_rows::MAX_INDEX)
+	{
+		LOGGER->warn("Invalid points number: {}", points_number);
+		return false;
+	}
+	if(subsets_number == 0 || subsets_number > sparse_rows::MAX_INDEX)
+	{
+		LOGGER->warn("Invalid subsets number: {}", subsets_number);
+		return false;
+	}
+	const size_t indexes_words_number = uscp::problem::indexes_words_number(covering_number);
+	if(covering_number > points_number * subsets_number
+	   || words_number
+	        != BINARY_INSTANCE_HEADER_SIZE + (subsets_number + 1) + (points_number + 1)
+	             + 2 * indexes_words_number)
+	{
+		LOGGER->warn("Invalid file format");
+		return false;
+	}
+
+	const sparse_rows::offset_type* subsets_points_offsets = header + BINARY_INSTANCE_HEADER_SIZE;
+	const sparse_rows::offset_type* points_subsets_offsets =
+	  subsets_points_offsets + subsets_number + 1;
+	const auto* subsets_points_indexes =
+	  reinterpret_cast<const sparse_rows::index_type*>(points_subsets_offsets + points_number + 1);
+	const auto* points_subsets_indexes = reinterpret_cast<const sparse_rows::index_type*>(
+	  reinterpret_cast<const uint64_t*>(subsets_points_indexes) + indexes_words_number);
+	sparse_rows subsets_points(
+	  file, subsets_points_offsets, subsets_points_indexes, subsets_number);
+	sparse_rows points_subsets(
+	  file, points_subsets_offsets, points_subsets_indexes, points_number);
+	if(subsets_points.indexes_number() != covering_number
+	   || points_subsets.indexes_number() != covering_number
+	   || !is_valid(subsets_points, points_number) || !is_valid(points_subsets, subsets_number))
+	{
+		LOGGER->warn("Invalid file format");
+		return false;
+	}
+
+	uscp::problem::instance instance = instance_out;
+	set_subsets_points(
+	  instance, points_number, std::move(subsets_points), std::move(points_subsets));
+	if(instance.content_fingerprint != header[2])
+	{
+		LOGGER->warn("Invalid content fingerprint");
+		return false;
+	}
+
+	// Success
+	instance_out = std::move(instance);
+
+	LOGGER->info("Successfully read problem instance with {} points and {} subsets in {}s",
+	             points_number,
+	             subsets_number,
+	             timer.elapsed());
+
+	return true;
+}
+
+bool uscp::problem::binary::write(const uscp::problem::instance& instance,
+                                  const std::filesystem::path& path,
+                                  bool override_file,
+                                  const std::filesystem::path& source_path) noexcept
+{
+	return write_rows(instance.content_fingerprint,
+	                  instance.subsets_points_csr,
+	                  instance.points_subsets_csr,
+	                  path,
+	                  override_file,
+	                  source_path);
+}
+
+bool uscp::problem::binary::write(const uscp::problem::sparse_rows& subsets_points,
+                                  const uscp::problem::sparse_rows& points_subsets,
+                                  const std::filesystem::path& path,
+                                  bool override_file,
+                                  const std::filesystem::path& source_path) noexcept
+{
+	assert(subsets_points.indexes_number() == points_subsets.indexes_number());
+	return write_rows(fingerprint(points_subsets.rows_number(), subsets_points),
+	                  subsets_points,
+	                  points_subsets,
+	                  path,
+	                  override_file,
+	                  source_path);
+}
+
+bool uscp::problem::binary::is_up_to_date(const std::filesystem::path& path,
+                                          const std::filesystem::path& source_path) noexcept
+{
+	std::error_code error;
+	if(!std::filesystem::exists(source_path, error))
+	{
+		return true;
+	}
+	source_stamp stamp;
+	if(!read_source_stamp(source_path, stamp))
+	{
+		return false;
+	}
+
+	uint64_t header[BINARY_INSTANCE_HEADER_SIZE] = {};
+	std::ifstream file(path, std::ios::binary);
+	if(!file.read(reinterpret_cast<char*>(header), sizeof(header)))
+	{
+		return false;
+	}
+	return header[0] == BINARY_INSTANCE_MAGIC && header[1] == BINARY_INSTANCE_VERSION
+	       && header[6] == stamp.size && header[7] == stamp.time;
+}
+
+std::filesystem::path uscp::problem::binary::instance_path(
+  const uscp::problem::instance_info& info) noexcept
+{
+	return std::string(BINARY_INSTANCES_FOLDER) + std::string(info.name) + ".bin";
+}
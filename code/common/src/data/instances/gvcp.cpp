@@ -8,108 +8,102 @@
 #include "common/data/instances/gvcp.hpp"
 #include "common/utils/logger.hpp"
 #include "common/utils/timer.hpp"
+#include "common/utils/file.hpp"
 
-#include <fstream>
+#include <charconv>
 #include <cassert>
 #include <deque>
-#include <sstream>
+#include <system_error>
+#include <utility>
+#include <vector>
 
 namespace
 {
-	std::optional<std::stringstream> get_content_line(std::ifstream& instance_stream) noexcept
+	struct gvcp_content final
 	{
-		std::stringstream line_stream;
-		char c = static_cast<char>(instance_stream.get());
-		while(instance_stream.good())
-		{
-			switch(c)
-			{
-				case '\n':
-				case '\t':
-				case ' ':
-					// ignore
-					break;
-				case '#':
-				{
-					// ignore line
-					do
-					{
-						c = static_cast<char>(instance_stream.get());
-					} while(instance_stream.good() && c != '\n');
-					break;
-				}
-				default:
-				{
-					// read line
-					do
-					{
-						line_stream << c;
-						c = static_cast<char>(instance_stream.get());
-					} while(instance_stream.good() && c != '\n');
-					return line_stream;
-				}
-			}
-			c = static_cast<char>(instance_stream.get());
-		}
-		return {};
-	}
+		size_t points_number = 0;
+		size_t subsets_number = 0;
+		// (subset, point) pairs, points of a subset are read in increasing order
+		std::vector<std::pair<uscp::problem::sparse_rows::index_type,
+		                      uscp::problem::sparse_rows::index_type>>
+		  subsets_points;
+	};
 
-	bool process_file(const std::filesystem::path& path, uscp::problem::instance& instance)
+	bool process_file(const std::filesystem::path& path, gvcp_content& content)
 	{
-		std::ifstream instance_stream(path);
-		if(!instance_stream)
+		mapped_file file;
+		if(!file.open(path))
 		{
-			SPDLOG_LOGGER_DEBUG(LOGGER, "std::ifstream constructor failed");
 			LOGGER->warn("Failed to read file {}", path);
 			return false;
 		}
 
-		std::optional<std::stringstream> content_line = get_content_line(instance_stream);
-		size_t processed_subsets = instance.subsets_number;
-		while(content_line)
+		// each content line gives the local subset of each point, subsets of a line are numbered
+		// after the subsets of the previous lines
+		const char* it = reinterpret_cast<const char*>(file.data());
+		const char* const end = it + file.size();
+		size_t processed_subsets = content.subsets_number;
+		while(it != end)
 		{
-			std::stringstream& content_line_stream = *content_line;
-			int current_subset_local;
-			content_line_stream >> current_subset_local;
-			if(current_subset_local < 0)
+			// skip blank and comment lines
+			if(*it == '\n' || *it == '\r' || *it == '\t' || *it == ' ')
 			{
-				LOGGER->warn("Invalid subset number: {}", current_subset_local);
-				return false;
+				++it;
+				continue;
+			}
+			if(*it == '#')
+			{
+				while(it != end && *it != '\n')
+				{
+					++it;
+				}
+				continue;
 			}
-			size_t current_subset_global =
-			  processed_subsets + static_cast<size_t>(current_subset_local);
+
+			// read content line
 			size_t current_point = 0;
-			while(content_line_stream.good())
+			while(it != end && *it != '\n')
 			{
-				if(current_point >= instance.points_number)
+				if(*it == '\r' || *it == '\t' || *it == ' ')
 				{
-					instance.points_number = current_point + 1;
-					for(dynamic_bitset<>& subset_points: instance.subsets_points)
-					{
-						subset_points.resize(instance.points_number);
-					}
+					++it;
+					continue;
 				}
-				if(current_subset_global >= instance.subsets_number)
+				int current_subset_local = 0;
+				const std::from_chars_result result = std::from_chars(it, end, current_subset_local);
+				if(result.ec != std::errc())
 				{
-					instance.subsets_number = current_subset_global + 1;
-					instance.subsets_points.resize(instance.subsets_number,
-					                               dynamic_bitset<>(instance.points_number));
+					LOGGER->warn("Invalid file format");
+					return false;
 				}
-				instance.subsets_points[current_subset_global].set(current_point);
-
-				content_line_stream >> current_subset_local;
+				it = result.ptr;
 				if(current_subset_local < 0)
 				{
 					LOGGER->warn("Invalid subset number: {}", current_subset_local);
 					return false;
 				}
-				current_subset_global =
+				const size_t current_subset_global =
 				  processed_subsets + static_cast<size_t>(current_subset_local);
+				if(current_point >= uscp::problem::sparse_rows::MAX_INDEX
+				   || current_subset_global >= uscp::problem::sparse_rows::MAX_INDEX)
+				{
+					LOGGER->warn("Unsupported instance size");
+					return false;
+				}
+				content.subsets_points.emplace_back(
+				  static_cast<uscp::problem::sparse_rows::index_type>(current_subset_global),
+				  static_cast<uscp::problem::sparse_rows::index_type>(current_point));
+				if(current_subset_global >= content.subsets_number)
+				{
+					content.subsets_number = current_subset_global + 1;
+				}
 				++current_point;
 			}
-			processed_subsets = instance.subsets_number;
-
-			content_line = get_content_line(instance_stream);
+			if(current_point > content.points_number)
+			{
+				content.points_number = current_point;
+			}
+			processed_subsets = content.subsets_number;
 		}
 
 		LOGGER->info("Processed file {}", path);
@@ -122,7 +116,10 @@ bool uscp::problem::gvcp::read(const std::filesystem::path& base_path,
 {
 	instance_out.subsets_number = 0;
 	instance_out.points_number = 0;
+	instance_out.subsets_points_csr = {};
+	instance_out.points_subsets_csr = {};
 	instance_out.subsets_points.clear();
+	instance_out.content_fingerprint = 0;
 	const timer timer;
 
 	std::error_code error;
@@ -141,10 +138,10 @@ bool uscp::problem::gvcp::read(const std::filesystem::path& base_path,
 		return false;
 	}
 
-	uscp::problem::instance instance = instance_out;
+	gvcp_content content;
 	if(std::filesystem::is_regular_file(base_path, error))
 	{
-		if(!process_file(base_path, instance))
+		if(!process_file(base_path, content))
 		{
 			LOGGER->error("Failed to process file {}", base_path);
 			return false;
@@ -220,7 +217,7 @@ bool uscp::problem::gvcp::read(const std::filesystem::path& base_path,
 
 			if(std::filesystem::is_regular_file(path, error))
 			{
-				if(!process_file(path, instance))
+				if(!process_file(path, content))
 				{
 					LOGGER->error("Failed to process file {}", path);
 					return false;
@@ -236,6 +233,33 @@ bool uscp::problem::gvcp::read(const std::filesystem::path& base_path,
 		}
 	}
 
+	// counting sort on the subsets, pairs are visited in order so the subsets points are sorted
+	uscp::problem::instance instance = instance_out;
+	std::vector<sparse_rows::offset_type> subsets_points_offsets(content.subsets_number + 1, 0);
+	for(const auto& [subset, point]: content.subsets_points)
+	{
+		(void)point;
+		++subsets_points_offsets[subset + 1];
+	}
+	for(size_t i_subset = 0; i_subset < content.subsets_number; ++i_subset)
+	{
+		subsets_points_offsets[i_subset + 1] += subsets_points_offsets[i_subset];
+	}
+	std::vector<sparse_rows::index_type> subsets_points_indexes(content.subsets_points.size());
+	{
+		std::vector<sparse_rows::offset_type> subsets_points_next(
+		  std::cbegin(subsets_points_offsets), std::cend(subsets_points_offsets) - 1);
+		for(const auto& [subset, point]: content.subsets_points)
+		{
+			subsets_points_indexes[subsets_points_next[subset]++] = point;
+		}
+	}
+	content.subsets_points = {};
+	set_subsets_points(
+	  instance,
+	  content.points_number,
+	  sparse_rows(std::move(subsets_points_offsets), std::move(subsets_points_indexes)));
+
 	// Success
 	instance_out = std::move(instance);
 
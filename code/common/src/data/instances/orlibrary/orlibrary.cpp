@@ -8,6 +8,7 @@
 #include "common/data/instances/orlibrary/orlibrary.hpp"
 #include "common/utils/logger.hpp"
 #include "common/utils/timer.hpp"
+#include "common/utils/text_integers.hpp"
 
 #include <fstream>
 #include <string>
@@ -17,7 +18,10 @@ bool uscp::problem::orlibrary::orlibrary::read(const std::filesystem::path& path
 {
 	instance_out.subsets_number = 0;
 	instance_out.points_number = 0;
+	instance_out.subsets_points_csr = {};
+	instance_out.points_subsets_csr = {};
 	instance_out.subsets_points.clear();
+	instance_out.content_fingerprint = 0;
 	const timer timer;
 
 	std::error_code error;
@@ -50,10 +54,9 @@ bool uscp::problem::orlibrary::orlibrary::read(const std::filesystem::path& path
 		return false;
 	}
 
-	std::ifstream instance_stream(path);
-	if(!instance_stream)
+	text_integers instance_integers;
+	if(!instance_integers.open(path))
 	{
-		SPDLOG_LOGGER_DEBUG(LOGGER, "std::ifstream constructor failed");
 		LOGGER->warn("Failed to read file {}", path);
 		return false;
 	}
@@ -63,61 +66,64 @@ bool uscp::problem::orlibrary::orlibrary::read(const std::filesystem::path& path
 
 	// Read points number
 	size_t points_number = 0;
-	if(!instance_stream.good())
+	if(!instance_integers.next(points_number))
 	{
 		LOGGER->warn("Invalid file format");
 		return false;
 	}
-	instance_stream >> points_number;
 	if(points_number == 0)
 	{
 		LOGGER->warn("Invalid points number: {}", points_number);
 		return false;
 	}
-	instance.points_number = points_number;
+	if(points_number > sparse_rows::MAX_INDEX)
+	{
+		LOGGER->warn("Unsupported points number: {}", points_number);
+		return false;
+	}
 
 	// Read subsets number
 	size_t subsets_number = 0;
-	if(!instance_stream.good())
+	if(!instance_integers.next(subsets_number))
 	{
 		LOGGER->warn("Invalid file format");
 		return false;
 	}
-	instance_stream >> subsets_number;
 	if(subsets_number == 0)
 	{
 		LOGGER->warn("Invalid subsets number: {}", subsets_number);
 		return false;
 	}
-	instance.subsets_number = subsets_number;
+	if(subsets_number > sparse_rows::MAX_INDEX)
+	{
+		LOGGER->warn("Unsupported subsets number: {}", subsets_number);
+		return false;
+	}
 
 	// Read subsets costs
 	for(size_t i = 0; i < subsets_number; ++i)
 	{
-		if(!instance_stream.good())
+		size_t ignored_subset_cost = 0;
+		if(!instance_integers.next(ignored_subset_cost))
 		{
 			LOGGER->warn("Invalid file format");
 			return false;
 		}
-		size_t ignored_subset_cost;
-		instance_stream >> ignored_subset_cost;
 	}
 
 	// Read subsets covering points
-	instance.subsets_points.resize(subsets_number);
-	for(size_t i = 0; i < subsets_number; ++i)
-	{
-		instance.subsets_points[i].resize(points_number);
-	}
+	std::vector<sparse_rows::offset_type> points_subsets_offsets;
+	points_subsets_offsets.reserve(points_number + 1);
+	points_subsets_offsets.push_back(0);
+	std::vector<sparse_rows::index_type> points_subsets_indexes;
 	for(size_t i_point = 0; i_point < points_number; ++i_point)
 	{
 		size_t subsets_covering_point = 0;
-		if(!instance_stream.good())
+		if(!instance_integers.next(subsets_covering_point))
 		{
 			LOGGER->warn("Invalid file format");
 			return false;
 		}
-		instance_stream >> subsets_covering_point;
 		if(subsets_covering_point > subsets_number)
 		{
 			LOGGER->warn("Invalid value");
@@ -126,26 +132,30 @@ bool uscp::problem::orlibrary::orlibrary::read(const std::filesystem::path& path
 		for(size_t i_subset = 0; i_subset < subsets_covering_point; ++i_subset)
 		{
 			size_t subset_number = 0;
-			if(!instance_stream.good())
+			if(!instance_integers.next(subset_number))
 			{
 				LOGGER->warn("Invalid file format");
 				return false;
 			}
-			instance_stream >> subset_number;
 			if(subset_number == 0)
 			{
 				LOGGER->warn("Invalid value");
 				return false;
 			}
 			--subset_number; // numbered from 1 in the file
-			if(subset_number > subsets_number)
+			if(subset_number >= subsets_number)
 			{
 				LOGGER->warn("Invalid value");
 				return false;
 			}
-			instance.subsets_points[subset_number][i_point] = true;
+			points_subsets_indexes.push_back(static_cast<sparse_rows::index_type>(subset_number));
 		}
+		points_subsets_offsets.push_back(points_subsets_indexes.size());
 	}
+	set_points_subsets(
+	  instance,
+	  subsets_number,
+	  sparse_rows(std::move(points_subsets_offsets), std::move(points_subsets_indexes)));
 
 	// Success
 	instance_out = std::move(instance);
@@ -214,19 +224,11 @@ bool uscp::problem::orlibrary::orlibrary::write(const uscp::problem::instance& i
 	// Write subsets covering points
 	for(size_t i_point = 0; i_point < instance.points_number; ++i_point)
 	{
-		std::vector<size_t> subsets_covering_point;
-		for(size_t i_subset = 0; i_subset < instance.subsets_number; ++i_subset)
-		{
-			if(instance.subsets_points[i_subset][i_point])
-			{
-				subsets_covering_point.push_back(i_subset + 1); // numbered from 1 in the file
-			}
-		}
-
+		const sparse_rows::row_view subsets_covering_point = instance.points_subsets_csr[i_point];
 		instance_stream << subsets_covering_point.size() << " \n ";
-		for(size_t subset_number: subsets_covering_point)
+		for(sparse_rows::index_type subset: subsets_covering_point)
 		{
-			instance_stream << subset_number << " ";
+			instance_stream << subset + 1 << " "; // numbered from 1 in the file
 			if(++out_counter == return_at)
 			{
 				instance_stream << "\n ";
@@ -9,8 +9,8 @@
 #include "common/data/instance.hpp"
 #include "common/utils/logger.hpp"
 #include "common/utils/timer.hpp"
+#include "common/utils/text_integers.hpp"
 
-#include <fstream>
 #include <cassert>
 #include <cstddef>
 #include <string>
@@ -21,7 +21,10 @@ bool uscp::problem::orlibrary::rail::read(const std::filesystem::path& path,
 {
 	instance_out.subsets_number = 0;
 	instance_out.points_number = 0;
+	instance_out.subsets_points_csr = {};
+	instance_out.points_subsets_csr = {};
 	instance_out.subsets_points.clear();
+	instance_out.content_fingerprint = 0;
 	const timer timer;
 
 	std::error_code error;
@@ -54,10 +57,9 @@ bool uscp::problem::orlibrary::rail::read(const std::filesystem::path& path,
 		return false;
 	}
 
-	std::ifstream instance_stream(path);
-	if(!instance_stream)
+	text_integers instance_integers;
+	if(!instance_integers.open(path))
 	{
-		SPDLOG_LOGGER_DEBUG(LOGGER, "std::ifstream constructor failed");
 		LOGGER->warn("Failed to read file {}", path);
 		return false;
 	}
@@ -67,81 +69,91 @@ bool uscp::problem::orlibrary::rail::read(const std::filesystem::path& path,
 
 	// Read points number
 	size_t points_number = 0;
-	if(!instance_stream.good())
+	if(!instance_integers.next(points_number))
 	{
 		LOGGER->warn("Invalid file format");
 		return false;
 	}
-	instance_stream >> points_number;
 	if(points_number == 0)
 	{
 		LOGGER->warn("Invalid points number: {}", points_number);
 		return false;
 	}
-	instance.points_number = points_number;
+	if(points_number > sparse_rows::MAX_INDEX)
+	{
+		LOGGER->warn("Unsupported points number: {}", points_number);
+		return false;
+	}
 
 	// Read subsets number
 	size_t subsets_number = 0;
-	if(!instance_stream.good())
+	if(!instance_integers.next(subsets_number))
 	{
 		LOGGER->warn("Invalid file format");
 		return false;
 	}
-	instance_stream >> subsets_number;
 	if(subsets_number == 0)
 	{
 		LOGGER->warn("Invalid subsets number: {}", subsets_number);
 		return false;
 	}
-	instance.subsets_number = subsets_number;
+	if(subsets_number > sparse_rows::MAX_INDEX)
+	{
+		LOGGER->warn("Unsupported subsets number: {}", subsets_number);
+		return false;
+	}
 
 	// Read subsets information
-	instance.subsets_points.resize(subsets_number);
+	std::vector<sparse_rows::offset_type> subsets_points_offsets;
+	subsets_points_offsets.reserve(subsets_number + 1);
+	subsets_points_offsets.push_back(0);
+	std::vector<sparse_rows::index_type> subsets_points_indexes;
 	for(size_t i = 0; i < subsets_number; ++i)
 	{
-		instance.subsets_points[i].resize(points_number);
-
 		// cost
-		if(!instance_stream.good())
+		size_t ignored_subset_cost = 0;
+		if(!instance_integers.next(ignored_subset_cost))
 		{
 			LOGGER->warn("Invalid file format");
 			return false;
 		}
-		size_t ignored_subset_cost;
-		instance_stream >> ignored_subset_cost;
 
 		// number of points
-		if(!instance_stream.good())
+		size_t subset_points = 0;
+		if(!instance_integers.next(subset_points))
 		{
 			LOGGER->warn("Invalid file format");
 			return false;
 		}
-		size_t subset_points;
-		instance_stream >> subset_points;
 
 		for(size_t i_point = 0; i_point < subset_points; ++i_point)
 		{
-			if(!instance_stream.good())
+			size_t point_number = 0;
+			if(!instance_integers.next(point_number))
 			{
 				LOGGER->warn("Invalid file format");
 				return false;
 			}
-			size_t point_number;
-			instance_stream >> point_number;
 			if(point_number == 0)
 			{
 				LOGGER->warn("Invalid value");
 				return false;
 			}
 			--point_number; // numbered from 1 in the file
-			if(point_number > points_number)
+			if(point_number >= points_number)
 			{
 				LOGGER->warn("Invalid value");
 				return false;
 			}
-			instance.subsets_points[i].set(point_number);
+			subsets_points_indexes.push_back(static_cast<sparse_rows::index_type>(point_number));
 		}
+		subsets_points_offsets.push_back(subsets_points_indexes.size());
 	}
+	set_subsets_points(
+	  instance,
+	  points_number,
+	  normalize(sparse_rows(std::move(subsets_points_offsets), std::move(subsets_points_indexes)),
+	            points_number));
 
 	// Success
 	instance_out = std::move(instance);
@@ -8,16 +8,96 @@
 #include "common/data/instances/sts.hpp"
 #include "common/utils/logger.hpp"
 #include "common/utils/timer.hpp"
+#include "common/utils/text_integers.hpp"
 
-#include <fstream>
+#include <algorithm>
 #include <cassert>
+#include <utility>
+#include <vector>
+
+namespace
+{
+	using uscp::problem::sparse_rows;
+
+	// Bose construction of STS(6n+3) on Z_(2n+1) x Z_3, triples flattened and sorted
+	std::vector<sparse_rows::index_type> bose_triples(size_t order) noexcept
+	{
+		assert(order % 6 == 3);
+		const size_t m = order / 3;
+		const size_t half = (m + 1) / 2; // inverse of 2 modulo m
+		const auto point = [m](size_t x, size_t i) noexcept {
+			return static_cast<sparse_rows::index_type>(i * m + x);
+		};
+
+		std::vector<sparse_rows::index_type> triples;
+		triples.reserve(order * (order - 1) / 2);
+		for(size_t x = 0; x < m; ++x)
+		{
+			triples.insert(std::end(triples), {point(x, 0), point(x, 1), point(x, 2)});
+		}
+		for(size_t i = 0; i < 3; ++i)
+		{
+			for(size_t x = 0; x < m; ++x)
+			{
+				for(size_t y = x + 1; y < m; ++y)
+				{
+					// idempotent commutative quasigroup x.y = (x + y) / 2
+					const size_t z = (x + y) * half % m;
+					sparse_rows::index_type triple[3] = {
+					  point(x, i), point(y, i), point(z, (i + 1) % 3)};
+					std::sort(std::begin(triple), std::end(triple));
+					triples.insert(std::end(triples), std::begin(triple), std::end(triple));
+				}
+			}
+		}
+		return triples;
+	}
+
+	// STS(3v) from the sorted triples of a STS(v), on 3 copies of its points
+	std::vector<sparse_rows::index_type> tripled_triples(
+	  size_t order,
+	  const std::vector<sparse_rows::index_type>& triples) noexcept
+	{
+		const auto v = static_cast<sparse_rows::index_type>(order);
+		std::vector<sparse_rows::index_type> tripled;
+		tripled.reserve(9 * triples.size() + 3 * order);
+
+		// triples of each copy
+		for(sparse_rows::index_type i = 0; i < 3; ++i)
+		{
+			for(sparse_rows::index_type point: triples)
+			{
+				tripled.push_back(i * v + point);
+			}
+		}
+		// copies of a point
+		for(sparse_rows::index_type x = 0; x < v; ++x)
+		{
+			tripled.insert(std::end(tripled), {x, v + x, 2 * v + x});
+		}
+		// a point of a triple in each copy
+		for(size_t i_triple = 0; i_triple < triples.size(); i_triple += 3)
+		{
+			sparse_rows::index_type triple[3] = {
+			  triples[i_triple], triples[i_triple + 1], triples[i_triple + 2]};
+			do
+			{
+				tripled.insert(std::end(tripled), {triple[0], v + triple[1], 2 * v + triple[2]});
+			} while(std::next_permutation(std::begin(triple), std::end(triple)));
+		}
+		return tripled;
+	}
+} // namespace
 
 bool uscp::problem::sts::read(const std::filesystem::path& path,
                               uscp::problem::instance& instance_out) noexcept
 {
 	instance_out.subsets_number = 0;
 	instance_out.points_number = 0;
+	instance_out.subsets_points_csr = {};
+	instance_out.points_subsets_csr = {};
 	instance_out.subsets_points.clear();
+	instance_out.content_fingerprint = 0;
 	const timer timer;
 
 	std::error_code error;
@@ -50,10 +130,9 @@ bool uscp::problem::sts::read(const std::filesystem::path& path,
 		return false;
 	}
 
-	std::ifstream instance_stream(path);
-	if(!instance_stream)
+	text_integers instance_integers;
+	if(!instance_integers.open(path))
 	{
-		SPDLOG_LOGGER_DEBUG(LOGGER, "std::ifstream constructor failed");
 		LOGGER->warn("Failed to read file {}", path);
 		return false;
 	}
@@ -63,65 +142,75 @@ bool uscp::problem::sts::read(const std::filesystem::path& path,
 
 	// Read subsets number
 	size_t subsets_number = 0;
-	if(!instance_stream.good())
+	if(!instance_integers.next(subsets_number))
 	{
 		LOGGER->warn("Invalid file format");
 		return false;
 	}
-	instance_stream >> subsets_number;
 	if(subsets_number == 0)
 	{
 		LOGGER->warn("Invalid subsets number: {}", subsets_number);
 		return false;
 	}
-	instance.subsets_number = subsets_number;
+	if(subsets_number > sparse_rows::MAX_INDEX)
+	{
+		LOGGER->warn("Unsupported subsets number: {}", subsets_number);
+		return false;
+	}
 
 	// Read points number
 	size_t points_number = 0;
-	if(!instance_stream.good())
+	if(!instance_integers.next(points_number))
 	{
 		LOGGER->warn("Invalid file format");
 		return false;
 	}
-	instance_stream >> points_number;
 	if(points_number == 0)
 	{
 		LOGGER->warn("Invalid points number: {}", points_number);
 		return false;
 	}
-	instance.points_number = points_number;
-
-	// Read subsets covering points
-	instance.subsets_points.resize(subsets_number);
-	for(size_t i = 0; i < subsets_number; ++i)
+	if(points_number > sparse_rows::MAX_INDEX)
 	{
-		instance.subsets_points[i].resize(points_number);
+		LOGGER->warn("Unsupported points number: {}", points_number);
+		return false;
 	}
+
+	// Read subsets covering points
+	std::vector<sparse_rows::offset_type> points_subsets_offsets;
+	points_subsets_offsets.reserve(points_number + 1);
+	points_subsets_offsets.push_back(0);
+	std::vector<sparse_rows::index_type> points_subsets_indexes;
+	points_subsets_indexes.reserve(points_number * 3);
 	for(size_t i_point = 0; i_point < points_number; ++i_point)
 	{
 		for(size_t i_subset = 0; i_subset < 3; ++i_subset)
 		{
 			size_t subset_number = 0;
-			if(!instance_stream.good())
+			if(!instance_integers.next(subset_number))
 			{
 				LOGGER->warn("Invalid file format");
 				return false;
 			}
-			instance_stream >> subset_number;
 			if(subset_number == 0)
 			{
 				LOGGER->warn("Invalid value");
 				return false;
 			}
 			--subset_number; // numbered from 1 in the file
-			if(subset_number > subsets_number)
+			if(subset_number >= subsets_number)
 			{
 				LOGGER->warn("Invalid value");
 				return false;
 			}
-			instance.subsets_points[subset_number][i_point] = true;
+			points_subsets_indexes.push_back(static_cast<sparse_rows::index_type>(subset_number));
 		}
+		points_subsets_offsets.push_back(points_subsets_indexes.size());
 	}
+	set_points_subsets(
+	  instance,
+	  subsets_number,
+	  sparse_rows(std::move(points_subsets_offsets), std::move(points_subsets_indexes)));
 
 	// Success
 	instance_out = std::move(instance);
@@ -145,3 +234,65 @@ bool uscp::problem::sts::write(const uscp::problem::instance& instance,
 	assert(false);
 	return false;
 }
+
+bool uscp::problem::sts::generate(size_t order, uscp::problem::instance& instance_out) noexcept
+{
+	instance_out.subsets_number = 0;
+	instance_out.points_number = 0;
+	instance_out.subsets_points_csr = {};
+	instance_out.points_subsets_csr = {};
+	instance_out.subsets_points.clear();
+	instance_out.content_fingerprint = 0;
+	const timer timer;
+
+	if(order % 6 != 3)
+	{
+		LOGGER->warn("Unsupported Steiner triple system order: {}", order);
+		return false;
+	}
+	const size_t triples_number = order * (order - 1) / 6;
+	if(triples_number > sparse_rows::MAX_INDEX)
+	{
+		LOGGER->warn("Unsupported Steiner triple system order: {}", order);
+		return false;
+	}
+
+	// tripling down to STS(3) or STS(15) for the orders of the registered instances
+	size_t base_order = order;
+	size_t triplings = 0;
+	while(base_order != 15 && base_order % 9 == 0)
+	{
+		base_order /= 3;
+		++triplings;
+	}
+	std::vector<sparse_rows::index_type> triples = bose_triples(base_order);
+	for(size_t i = 0; i < triplings; ++i)
+	{
+		triples = tripled_triples(base_order, triples);
+		base_order *= 3;
+	}
+	assert(base_order == order);
+	assert(triples.size() == 3 * triples_number);
+
+	// same layout as read: points are the triples, subsets are the points of the triple system
+	std::vector<sparse_rows::offset_type> points_subsets_offsets(triples_number + 1);
+	for(size_t i_point = 0; i_point <= triples_number; ++i_point)
+	{
+		points_subsets_offsets[i_point] = 3 * i_point;
+	}
+	sparse_rows points_subsets(std::move(points_subsets_offsets), std::move(triples));
+	sparse_rows subsets_points = transpose(points_subsets, order);
+	uscp::problem::instance instance = instance_out;
+	set_subsets_points(
+	  instance, triples_number, std::move(subsets_points), std::move(points_subsets));
+
+	// Success
+	instance_out = std::move(instance);
+
+	LOGGER->info("Successfully generated problem instance with {} points and {} subsets in {}s",
+	             triples_number,
+	             order,
+	             timer.elapsed());
+
+	return true;
+}
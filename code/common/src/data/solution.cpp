@@ -51,6 +51,14 @@ uscp::solution& uscp::solution::operator=(uscp::solution&& other) noexcept
 	return *this;
 }
 
+uint64_t uscp::solution_hash(const uscp::solution& solution) noexcept
+{
+	uint64_t hash = 0;
+	solution.selected_subsets.iterate_bits_on(
+	  [&](size_t bit_on) noexcept { hash ^= subset_hash(bit_on); });
+	return hash;
+}
+
 void uscp::solution::compute_cover() noexcept
 {
 	assert(selected_subsets.size() == problem.subsets_number);
@@ -60,7 +68,7 @@ void uscp::solution::compute_cover() noexcept
 	size_t selected_subset = selected_subsets.find_first();
 	while(selected_subset != dynamic_bitset<>::npos)
 	{
-		covered_points |= problem.subsets_points[selected_subset];
+		problem::add_subset_points(problem, selected_subset, covered_points);
 		selected_subset = selected_subsets.find_next(selected_subset);
 	}
 	cover_all_points = covered_points.all();
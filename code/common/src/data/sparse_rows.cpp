@@ -0,0 +1,184 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#include "common/data/sparse_rows.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace
+{
+	struct owned_storage final
+	{
+		std::vector<uscp::problem::sparse_rows::offset_type> offsets;
+		std::vector<uscp::problem::sparse_rows::index_type> indexes;
+	};
+
+	// offsets of the empty rows, offsets() always has rows_number() + 1 values
+	constexpr uscp::problem::sparse_rows::offset_type EMPTY_OFFSETS[1] = {0};
+} // namespace
+
+uscp::problem::sparse_rows::sparse_rows() noexcept
+  : m_storage(), m_offsets(EMPTY_OFFSETS), m_indexes(nullptr), m_rows_number(0)
+{
+}
+
+uscp::problem::sparse_rows::sparse_rows(std::vector<offset_type> offsets,
+                                        std::vector<index_type> indexes) noexcept
+  : sparse_rows()
+{
+	assert(!offsets.empty());
+	assert(offsets.front() == 0);
+	assert(offsets.back() == indexes.size());
+	std::shared_ptr<owned_storage> storage = std::make_shared<owned_storage>();
+	storage->offsets = std::move(offsets);
+	storage->indexes = std::move(indexes);
+	m_offsets = storage->offsets.data();
+	m_indexes = storage->indexes.data();
+	m_rows_number = storage->offsets.size() - 1;
+	m_storage = std::move(storage);
+}
+
+uscp::problem::sparse_rows::sparse_rows(std::shared_ptr<const void> storage,
+                                        const offset_type* offsets,
+                                        const index_type* indexes,
+                                        size_t rows_number) noexcept
+  : m_storage(std::move(storage))
+  , m_offsets(offsets)
+  , m_indexes(indexes)
+  , m_rows_number(rows_number)
+{
+}
+
+bool uscp::problem::sparse_rows::contains(size_t row, size_t index) const noexcept
+{
+	const row_view row_indexes = (*this)[row];
+	return std::binary_search(row_indexes.begin(), row_indexes.end(), index);
+}
+
+uscp::problem::sparse_rows uscp::problem::transpose(const uscp::problem::sparse_rows& rows,
+                                                    size_t columns_number) noexcept
+{
+	assert(rows.rows_number() <= sparse_rows::MAX_INDEX);
+
+	// counting sort on the columns, rows are visited in order so the transposed rows are sorted
+	std::vector<sparse_rows::offset_type> offsets(columns_number + 1, 0);
+	const sparse_rows::index_type* indexes_begin = rows.indexes();
+	const sparse_rows::index_type* indexes_end = indexes_begin + rows.indexes_number();
+	for(const sparse_rows::index_type* it = indexes_begin; it != indexes_end; ++it)
+	{
+		assert(*it < columns_number);
+		++offsets[*it + 1];
+	}
+	for(size_t i = 0; i < columns_number; ++i)
+	{
+		offsets[i + 1] += offsets[i];
+	}
+
+	std::vector<sparse_rows::index_type> indexes(rows.indexes_number());
+	std::vector<sparse_rows::offset_type> positions(std::cbegin(offsets), std::cend(offsets) - 1);
+	for(size_t i_row = 0; i_row < rows.rows_number(); ++i_row)
+	{
+		for(sparse_rows::index_type column: rows[i_row])
+		{
+			indexes[positions[column]++] = static_cast<sparse_rows::index_type>(i_row);
+		}
+	}
+	return sparse_rows(std::move(offsets), std::move(indexes));
+}
+
+uscp::problem::sparse_rows uscp::problem::normalize(const uscp::problem::sparse_rows& rows,
+                                                    size_t columns_number) noexcept
+{
+	// double transposition: rows sorted, duplicates adjacent
+	const sparse_rows sorted_rows = transpose(transpose(rows, columns_number), rows.rows_number());
+
+	std::vector<sparse_rows::offset_type> offsets;
+	offsets.reserve(rows.rows_number() + 1);
+	offsets.push_back(0);
+	std::vector<sparse_rows::index_type> indexes;
+	indexes.reserve(sorted_rows.indexes_number());
+	for(size_t i_row = 0; i_row < sorted_rows.rows_number(); ++i_row)
+	{
+		const sparse_rows::row_view row = sorted_rows[i_row];
+		indexes.insert(std::end(indexes), row.begin(), row.end());
+		indexes.erase(std::unique(std::begin(indexes) + static_cast<std::ptrdiff_t>(offsets.back()),
+		                          std::end(indexes)),
+		              std::end(indexes));
+		offsets.push_back(indexes.size());
+	}
+	return sparse_rows(std::move(offsets), std::move(indexes));
+}
+
+bool uscp::problem::is_subset_of(const uscp::problem::sparse_rows::index_type* first,
+                                 const uscp::problem::sparse_rows::index_type* last,
+                                 uscp::problem::sparse_rows::row_view row) noexcept
+{
+	if(static_cast<size_t>(last - first) > row.size())
+	{
+		return false;
+	}
+	return std::includes(row.begin(), row.end(), first, last);
+}
+
+bool uscp::problem::is_valid(const uscp::problem::sparse_rows& rows,
+                             size_t columns_number) noexcept
+{
+	const sparse_rows::offset_type* offsets = rows.offsets();
+	if(offsets[0] != 0)
+	{
+		return false;
+	}
+	for(size_t i_row = 0; i_row < rows.rows_number(); ++i_row)
+	{
+		if(offsets[i_row + 1] < offsets[i_row])
+		{
+			return false;
+		}
+	}
+	for(size_t i_row = 0; i_row < rows.rows_number(); ++i_row)
+	{
+		const sparse_rows::row_view row = rows[i_row];
+		for(size_t i = 0; i < row.size(); ++i)
+		{
+			if(row[i] >= columns_number || (i > 0 && row[i] <= row[i - 1]))
+			{
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+size_t uscp::problem::indexes_words_number(size_t indexes_number) noexcept
+{
+	return (indexes_number * sizeof(sparse_rows::index_type) + sizeof(uint64_t) - 1)
+	       / sizeof(uint64_t);
+}
+
+void uscp::problem::write_offsets(std::ostream& stream,
+                                  const uscp::problem::sparse_rows& rows) noexcept
+{
+	stream.write(reinterpret_cast<const char*>(rows.offsets()),
+	             static_cast<std::streamsize>((rows.rows_number() + 1)
+	                                          * sizeof(sparse_rows::offset_type)));
+}
+
+void uscp::problem::write_indexes(std::ostream& stream,
+                                  const uscp::problem::sparse_rows& rows) noexcept
+{
+	const size_t indexes_size = rows.indexes_number() * sizeof(sparse_rows::index_type);
+	if(indexes_size > 0)
+	{
+		stream.write(reinterpret_cast<const char*>(rows.indexes()),
+		             static_cast<std::streamsize>(indexes_size));
+	}
+	const size_t padding = indexes_words_number(rows.indexes_number()) * sizeof(uint64_t)
+	                       - indexes_size;
+	const char zeros[sizeof(uint64_t)] = {};
+	stream.write(zeros, static_cast<std::streamsize>(padding));
+}
@@ -0,0 +1,176 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#include "common/utils/file.hpp"
+#include "common/utils/logger.hpp"
+
+#include <fstream>
+#include <random>
+#include <string>
+#include <utility>
+
+#if defined(USCP_MAPPED_FILE_MMAP)
+#	include <fcntl.h>
+#	include <sys/mman.h>
+#	include <sys/stat.h>
+#	include <unistd.h>
+#endif
+
+mapped_file::mapped_file() noexcept: m_data(nullptr), m_size(0)
+{
+}
+
+mapped_file::mapped_file(mapped_file&& other) noexcept
+  : m_data(std::exchange(other.m_data, nullptr))
+  , m_size(std::exchange(other.m_size, 0))
+#if !defined(USCP_MAPPED_FILE_MMAP)
+  , m_buffer(std::move(other.m_buffer))
+#endif
+{
+}
+
+mapped_file& mapped_file::operator=(mapped_file&& other) noexcept
+{
+	if(this != &other)
+	{
+		close();
+		m_data = std::exchange(other.m_data, nullptr);
+		m_size = std::exchange(other.m_size, 0);
+#if !defined(USCP_MAPPED_FILE_MMAP)
+		m_buffer = std::move(other.m_buffer);
+#endif
+	}
+	return *this;
+}
+
+mapped_file::~mapped_file() noexcept
+{
+	close();
+}
+
+bool mapped_file::open(const std::filesystem::path& path) noexcept
+{
+	close();
+#if defined(USCP_MAPPED_FILE_MMAP)
+	const int file_descriptor = ::open(path.c_str(), O_RDONLY);
+	if(file_descriptor < 0)
+	{
+		SPDLOG_LOGGER_DEBUG(LOGGER, "open failed on {}", path);
+		return false;
+	}
+	struct stat file_stat = {};
+	if(::fstat(file_descriptor, &file_stat) != 0)
+	{
+		SPDLOG_LOGGER_DEBUG(LOGGER, "fstat failed on {}", path);
+		::close(file_descriptor);
+		return false;
+	}
+	const size_t size = static_cast<size_t>(file_stat.st_size);
+	if(size == 0)
+	{
+		// mmap does not support empty mappings
+		::close(file_descriptor);
+		m_data = nullptr;
+		m_size = 0;
+		return true;
+	}
+	void* mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+	::close(file_descriptor);
+	if(mapping == MAP_FAILED)
+	{
+		SPDLOG_LOGGER_DEBUG(LOGGER, "mmap failed on {}", path);
+		return false;
+	}
+	m_data = static_cast<const std::byte*>(mapping);
+	m_size = size;
+	return true;
+#else
+	std::ifstream file(path, std::ios::in | std::ios::binary | std::ios::ate);
+	if(!file)
+	{
+		SPDLOG_LOGGER_DEBUG(LOGGER, "std::ifstream constructor failed on {}", path);
+		return false;
+	}
+	m_buffer.resize(static_cast<size_t>(file.tellg()));
+	file.seekg(0);
+	if(!file.read(reinterpret_cast<char*>(m_buffer.data()),
+	              static_cast<std::streamsize>(m_buffer.size())))
+	{
+		SPDLOG_LOGGER_DEBUG(LOGGER, "std::ifstream::read failed on {}", path);
+		m_buffer.clear();
+		return false;
+	}
+	m_data = m_buffer.data();
+	m_size = m_buffer.size();
+	return true;
+#endif
+}
+
+void mapped_file::close() noexcept
+{
+#if defined(USCP_MAPPED_FILE_MMAP)
+	if(m_data != nullptr)
+	{
+		::munmap(const_cast<std::byte*>(m_data), m_size);
+	}
+#else
+	m_buffer.clear();
+	m_buffer.shrink_to_fit();
+#endif
+	m_data = nullptr;
+	m_size = 0;
+}
+
+bool mapped_file::is_open() const noexcept
+{
+	return m_data != nullptr;
+}
+
+const std::byte* mapped_file::data() const noexcept
+{
+	return m_data;
+}
+
+size_t mapped_file::size() const noexcept
+{
+	return m_size;
+}
+
+bool write_file_atomically(const std::filesystem::path& path,
+                           const std::function<bool(std::ostream&)>& writer) noexcept
+{
+	std::filesystem::path temporary_path = path;
+	temporary_path += ".tmp" + std::to_string(std::random_device{}());
+	{
+		std::ofstream stream(temporary_path, std::ios::out | std::ios::binary | std::ios::trunc);
+		if(!stream)
+		{
+			SPDLOG_LOGGER_DEBUG(LOGGER, "std::ofstream constructor failed");
+			LOGGER->error("Failed to write file {}", temporary_path);
+			return false;
+		}
+		if(!writer(stream) || !stream.flush())
+		{
+			LOGGER->error("Failed to write file {}", temporary_path);
+			stream.close();
+			std::error_code ignored;
+			std::filesystem::remove(temporary_path, ignored);
+			return false;
+		}
+	}
+	std::error_code error;
+	std::filesystem::rename(temporary_path, path, error);
+	if(error)
+	{
+		SPDLOG_LOGGER_DEBUG(LOGGER, "std::filesystem::rename failed: {}", error.message());
+		LOGGER->error("Failed to write file {}", path);
+		std::error_code ignored;
+		std::filesystem::remove(temporary_path, ignored);
+		return false;
+	}
+	return true;
+}
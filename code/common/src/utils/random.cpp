@@ -0,0 +1,55 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#include "common/utils/random.hpp"
+
+namespace
+{
+	// SplitMix64 finalizer, see http://prng.di.unimi.it/splitmix64.c
+	uint64_t mix(uint64_t value) noexcept
+	{
+		value += 0x9e3779b97f4a7c15;
+		value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9;
+		value = (value ^ (value >> 27)) * 0x94d049bb133111eb;
+		return value ^ (value >> 31);
+	}
+
+	uint64_t draw_seed(uscp::random_engine& generator) noexcept
+	{
+		const uint64_t high = generator();
+		const uint64_t low = generator();
+		return (high << 32) | low;
+	}
+} // namespace
+
+uscp::random_streams::random_streams(uint64_t seed) noexcept: m_seed(seed)
+{
+}
+
+uscp::random_streams::random_streams(uscp::random_engine& generator) noexcept
+  : m_seed(draw_seed(generator))
+{
+}
+
+uscp::random_engine uscp::random_streams::stream(uint64_t index) const noexcept
+{
+	std::seed_seq stream_seed{static_cast<uint32_t>(m_seed),
+	                          static_cast<uint32_t>(m_seed >> 32),
+	                          static_cast<uint32_t>(index),
+	                          static_cast<uint32_t>(index >> 32)};
+	return random_engine(stream_seed);
+}
+
+uscp::random_streams uscp::random_streams::split(uint64_t index) const noexcept
+{
+	return random_streams(mix(m_seed ^ mix(index)));
+}
+
+uint64_t uscp::random_streams::seed() const noexcept
+{
+	return m_seed;
+}
@@ -0,0 +1,112 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#include "common/utils/text_integers.hpp"
+#include "common/utils/file.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <system_error>
+
+namespace
+{
+	constexpr size_t CHUNK_SIZE = 1 << 22;
+
+	[[nodiscard]] constexpr bool is_space(char c) noexcept
+	{
+		return c == ' ' || c == '\n' || c == '\r' || c == '\t' || c == '\v' || c == '\f';
+	}
+
+	// return false if stopped on an invalid value
+	bool parse_chunk(const char* first, const char* last, std::vector<uint32_t>& values) noexcept
+	{
+		values.reserve(static_cast<size_t>(last - first) / 4);
+		while(true)
+		{
+			while(first != last && is_space(*first))
+			{
+				++first;
+			}
+			if(first == last)
+			{
+				return true;
+			}
+			uint32_t value = 0;
+			const std::from_chars_result result = std::from_chars(first, last, value);
+			if(result.ec != std::errc())
+			{
+				return false;
+			}
+			values.push_back(value);
+			first = result.ptr;
+		}
+	}
+} // namespace
+
+text_integers::text_integers() noexcept: m_chunks(1), m_chunk(0), m_position(0)
+{
+}
+
+bool text_integers::open(const std::filesystem::path& path) noexcept
+{
+	mapped_file file;
+	if(!file.open(path))
+	{
+		return false;
+	}
+	parse(std::string_view(reinterpret_cast<const char*>(file.data()), file.size()));
+	return true;
+}
+
+void text_integers::parse(std::string_view text) noexcept
+{
+	const char* const first = text.data();
+	const char* const last = text.data() + text.size();
+
+	// chunks boundaries moved to whitespaces, values are never split
+	std::vector<const char*> boundaries;
+	boundaries.push_back(first);
+	while(static_cast<size_t>(last - boundaries.back()) > CHUNK_SIZE)
+	{
+		const char* boundary = boundaries.back() + CHUNK_SIZE;
+		while(boundary != last && !is_space(*boundary))
+		{
+			++boundary;
+		}
+		boundaries.push_back(boundary);
+	}
+	boundaries.push_back(last);
+	const size_t chunks_number = boundaries.size() - 1;
+
+	m_chunks.assign(chunks_number, {});
+	std::vector<char> chunks_valid(chunks_number, 1);
+	// https://gcc.gnu.org/gcc-9/porting_to.html#ompdatasharing
+#if __GNUC__ < 9
+#	pragma omp parallel for default(none) schedule(dynamic, 1) if(chunks_number > 1) \
+	  shared(boundaries, chunks_valid)
+#else
+#	pragma omp parallel for default(none) schedule(dynamic, 1) if(chunks_number > 1) \
+	  shared(chunks_number, boundaries, chunks_valid)
+#endif
+	for(/*no size_t for openMP on Windows*/ int i_chunk_int = 0;
+	    i_chunk_int < static_cast<int>(chunks_number);
+	    ++i_chunk_int)
+	{
+		const size_t i_chunk = static_cast<size_t>(i_chunk_int);
+		chunks_valid[i_chunk] =
+		  parse_chunk(boundaries[i_chunk], boundaries[i_chunk + 1], m_chunks[i_chunk]);
+	}
+
+	// drop everything after the first invalid value
+	const auto invalid_chunk = std::find(std::cbegin(chunks_valid), std::cend(chunks_valid), 0);
+	if(invalid_chunk != std::cend(chunks_valid))
+	{
+		m_chunks.resize(static_cast<size_t>(invalid_chunk - std::cbegin(chunks_valid)) + 1);
+	}
+	m_chunk = 0;
+	m_position = 0;
+}
@@ -11,9 +11,7 @@
 #include "common/data/instance.hpp"
 #include "common/data/solution.hpp"
 #include "common/utils/random.hpp"
-#include "common/utils/logger.hpp"
-#include "solver/algorithms/random.hpp"
-#include "solver/algorithms/greedy.hpp"
+#include "solver/algorithms/crossovers/subproblem.hpp"
 
 #include <dynamic_bitset.hpp>
 
@@ -32,26 +30,24 @@ namespace uscp::crossover
 		extended_subproblem_greedy& operator=(const extended_subproblem_greedy& other) = delete;
 		extended_subproblem_greedy& operator=(extended_subproblem_greedy&& other) noexcept = delete;
 
-		solution apply1(const solution& a, const solution& b, random_engine& generator) const
-		  noexcept
+		void apply1(const solution& a,
+		            const solution& b,
+		            random_engine& generator,
+		            solution& child) const noexcept
 		{
-			solution random_solution =
-			  uscp::random::solve(generator, problem, NULL_LOGGER); // to extend the subproblem
-			dynamic_bitset<> authorized_subsets = random_solution.selected_subsets;
-			authorized_subsets |= a.selected_subsets;
-			authorized_subsets |= b.selected_subsets;
-			return uscp::greedy::restricted_solve(problem, authorized_subsets, NULL_LOGGER);
+			const subproblem extracted(
+			  problem, subproblem::extended_parents_subsets(a, b, generator));
+			extracted.solve_greedy(false, child);
 		}
 
-		solution apply2(const solution& a, const solution& b, random_engine& generator) const
-		  noexcept
+		void apply2(const solution& a,
+		            const solution& b,
+		            random_engine& generator,
+		            solution& child) const noexcept
 		{
-			solution random_solution =
-			  uscp::random::solve(generator, problem, NULL_LOGGER); // to extend the subproblem
-			dynamic_bitset<> authorized_subsets = random_solution.selected_subsets;
-			authorized_subsets |= a.selected_subsets;
-			authorized_subsets |= b.selected_subsets;
-			return uscp::greedy::restricted_rsolve(problem, authorized_subsets, NULL_LOGGER);
+			const subproblem extracted(
+			  problem, subproblem::extended_parents_subsets(a, b, generator));
+			extracted.solve_greedy(true, child);
 		}
 
 		[[nodiscard]] static std::string_view to_string() noexcept
@@ -11,7 +11,7 @@
 #include "common/data/instance.hpp"
 #include "common/data/solution.hpp"
 #include "common/utils/random.hpp"
-#include "solver/algorithms/random.hpp"
+#include "solver/algorithms/crossovers/subproblem.hpp"
 
 #include <dynamic_bitset.hpp>
 
@@ -30,28 +30,30 @@ namespace uscp::crossover
 		extended_subproblem_random& operator=(const extended_subproblem_random& other) = delete;
 		extended_subproblem_random& operator=(extended_subproblem_random&& other) noexcept = delete;
 
-		solution apply(const solution& a, const solution& b, random_engine& generator) const
-		  noexcept
+		void apply(const solution& a,
+		           const solution& b,
+		           random_engine& generator,
+		           solution& child) const noexcept
 		{
-			solution random_solution =
-			  uscp::random::solve(generator, problem, NULL_LOGGER); // to extend the subproblem
-			dynamic_bitset<> authorized_subsets = random_solution.selected_subsets;
-			authorized_subsets |= a.selected_subsets;
-			authorized_subsets |= b.selected_subsets;
-			return uscp::random::restricted_solve(
-			  generator, problem, authorized_subsets, NULL_LOGGER);
+			const subproblem extracted(
+			  problem, subproblem::extended_parents_subsets(a, b, generator));
+			extracted.solve_random(generator, child);
 		}
 
-		solution apply1(const solution& a, const solution& b, random_engine& generator) const
-		  noexcept
+		void apply1(const solution& a,
+		            const solution& b,
+		            random_engine& generator,
+		            solution& child) const noexcept
 		{
-			return apply(a, b, generator);
+			apply(a, b, generator, child);
 		}
 
-		solution apply2(const solution& a, const solution& b, random_engine& generator) const
-		  noexcept
+		void apply2(const solution& a,
+		            const solution& b,
+		            random_engine& generator,
+		            solution& child) const noexcept
 		{
-			return apply(a, b, generator);
+			apply(a, b, generator, child);
 		}
 
 		[[nodiscard]] static std::string_view to_string() noexcept
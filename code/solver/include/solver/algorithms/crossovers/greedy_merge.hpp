@@ -28,64 +28,74 @@ namespace uscp::crossover
 		greedy_merge& operator=(const greedy_merge& other) = delete;
 		greedy_merge& operator=(greedy_merge&& other) noexcept = delete;
 
-		solution apply(const solution& a,
-		               const solution& b,
-		               [[maybe_unused]] random_engine& generator) const noexcept
+		void apply(const solution& a,
+		           const solution& b,
+		           [[maybe_unused]] random_engine& generator,
+		           solution& child) const noexcept
 		{
 			const solution* current = &a;
 			bool current_is_a = true;
-			solution solution(problem);
-			while(!solution.cover_all_points)
+			child.selected_subsets.reset();
+			child.covered_points.reset();
+			child.cover_all_points = false;
+			size_t covered_points_number = 0;
+			while(!child.cover_all_points)
 			{
-				size_t max_subset_number = solution.selected_subsets.size(); //invalid initial value
-				dynamic_bitset<> covered_points_with_max_subset(problem.points_number);
-				size_t covered_points_number_with_max_subset = solution.covered_points.count();
-				dynamic_bitset<> new_covered_points;
+				size_t max_subset_number = child.selected_subsets.size(); //invalid initial value
+				size_t max_gain = 0;
 				current->selected_subsets.iterate_bits_on([&](size_t i) {
-					if(solution.selected_subsets[i])
+					if(child.selected_subsets[i])
 					{
 						// already selected
 						return;
 					}
 
-					new_covered_points = solution.covered_points;
-					new_covered_points |= problem.subsets_points[i];
-					const size_t new_covered_points_number = new_covered_points.count();
-					if(new_covered_points_number > covered_points_number_with_max_subset)
+					size_t gain = 0;
+					for(size_t point: problem.subsets_points_csr[i])
+					{
+						if(!child.covered_points.test(point))
+						{
+							++gain;
+						}
+					}
+					if(gain > max_gain)
 					{
 						max_subset_number = i;
-						covered_points_with_max_subset = new_covered_points;
-						covered_points_number_with_max_subset = new_covered_points_number;
+						max_gain = gain;
 					}
 				});
 
 				// all subset already included or no subset add covered points
-				if(max_subset_number == solution.selected_subsets.size())
+				if(max_subset_number == child.selected_subsets.size())
 				{
 					continue;
 				}
 				// update solution
-				solution.selected_subsets[max_subset_number].set();
-				solution.covered_points = covered_points_with_max_subset;
-				solution.cover_all_points = solution.covered_points.all();
+				child.selected_subsets[max_subset_number].set();
+				problem::add_subset_points(problem, max_subset_number, child.covered_points);
+				covered_points_number += max_gain;
+				child.cover_all_points = covered_points_number == problem.points_number;
 
 				// change current
 				current = current_is_a ? &b : &a;
 				current_is_a = !current_is_a;
 			}
-			return solution;
 		}
 
-		solution apply1(const solution& a, const solution& b, random_engine& generator) const
-		  noexcept
+		void apply1(const solution& a,
+		            const solution& b,
+		            random_engine& generator,
+		            solution& child) const noexcept
 		{
-			return apply(a, b, generator);
+			apply(a, b, generator, child);
 		}
 
-		solution apply2(const solution& a, const solution& b, random_engine& generator) const
-		  noexcept
+		void apply2(const solution& a,
+		            const solution& b,
+		            random_engine& generator,
+		            solution& child) const noexcept
 		{
-			return apply(b, a, generator);
+			apply(b, a, generator, child);
 		}
 
 		[[nodiscard]] static std::string_view to_string() noexcept
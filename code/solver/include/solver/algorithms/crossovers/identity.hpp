@@ -28,18 +28,20 @@ namespace uscp::crossover
 		identity& operator=(const identity& other) = delete;
 		identity& operator=(identity&& other) noexcept = delete;
 
-		solution apply1(const solution& a,
-		                [[maybe_unused]] const solution& b,
-		                [[maybe_unused]] random_engine& generator) const noexcept
+		void apply1(const solution& a,
+		            [[maybe_unused]] const solution& b,
+		            [[maybe_unused]] random_engine& generator,
+		            solution& child) const noexcept
 		{
-			return a;
+			child = a;
 		}
 
-		solution apply2([[maybe_unused]] const solution& a,
-		                const solution& b,
-		                [[maybe_unused]] random_engine& generator) const noexcept
+		void apply2([[maybe_unused]] const solution& a,
+		            const solution& b,
+		            [[maybe_unused]] random_engine& generator,
+		            solution& child) const noexcept
 		{
-			return b;
+			child = b;
 		}
 
 		[[nodiscard]] static std::string_view to_string() noexcept
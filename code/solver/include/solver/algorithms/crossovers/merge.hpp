@@ -28,28 +28,31 @@ namespace uscp::crossover
 		merge& operator=(const merge& other) = delete;
 		merge& operator=(merge&& other) noexcept = delete;
 
-		solution apply(const solution& a,
-		               const solution& b,
-		               [[maybe_unused]] random_engine& generator) const noexcept
+		void apply(const solution& a,
+		           const solution& b,
+		           [[maybe_unused]] random_engine& generator,
+		           solution& child) const noexcept
 		{
-			solution solution(problem);
-			solution.selected_subsets = a.selected_subsets;
-			solution.selected_subsets |= b.selected_subsets;
-			solution.covered_points.set();
-			solution.cover_all_points = true;
-			return solution;
+			child.selected_subsets = a.selected_subsets;
+			child.selected_subsets |= b.selected_subsets;
+			child.covered_points.set();
+			child.cover_all_points = true;
 		}
 
-		solution apply1(const solution& a, const solution& b, random_engine& generator) const
-		  noexcept
+		void apply1(const solution& a,
+		            const solution& b,
+		            random_engine& generator,
+		            solution& child) const noexcept
 		{
-			return apply(a, b, generator);
+			apply(a, b, generator, child);
 		}
 
-		solution apply2(const solution& a, const solution& b, random_engine& generator) const
-		  noexcept
+		void apply2(const solution& a,
+		            const solution& b,
+		            random_engine& generator,
+		            solution& child) const noexcept
 		{
-			return apply(a, b, generator);
+			apply(a, b, generator, child);
 		}
 
 		[[nodiscard]] static std::string_view to_string() noexcept
@@ -0,0 +1,140 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#ifndef USCP_SUBPROBLEM_HPP
+#define USCP_SUBPROBLEM_HPP
+
+#include "common/data/instance.hpp"
+#include "common/data/solution.hpp"
+#include "common/utils/random.hpp"
+#include "common/utils/logger.hpp"
+#include "solver/algorithms/greedy.hpp"
+#include "solver/algorithms/random.hpp"
+#include "solver/algorithms/rwls.hpp"
+#include "solver/data/instance.hpp"
+#include "solver/data/solution.hpp"
+
+#include <dynamic_bitset.hpp>
+
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+namespace uscp::crossover
+{
+	// Authorized subsets extracted with the points they cover to a standalone instance, then
+	// reduced: the subproblem is solved without restriction on the small reduced instance and the
+	// solution is expanded back to the full instance
+	class subproblem final
+	{
+	public:
+		subproblem(const problem::instance& full_instance,
+		           const dynamic_bitset<>& authorized_subsets) noexcept
+		  : m_subsets_mapping()
+		  , m_extracted_instance(
+		      problem::extract(full_instance, authorized_subsets, m_subsets_mapping))
+		  , m_reduced_instance(problem::reduce_subproblem(m_extracted_instance))
+		{
+		}
+		// the reduced instance refers to the extracted instance
+		subproblem(const subproblem&) = delete;
+		subproblem(subproblem&&) noexcept = delete;
+		subproblem& operator=(const subproblem& other) = delete;
+		subproblem& operator=(subproblem&& other) noexcept = delete;
+
+		// child = expanded solve(reduced instance), solve is not called if the reduction already
+		// covered all the points
+		template<typename Solve>
+		void solve(Solve&& solve, solution& child) const noexcept
+		{
+			if(m_reduced_instance.points_number == 0)
+			{
+				expand(solution(m_reduced_instance), child);
+				return;
+			}
+			expand(solve(m_reduced_instance), child);
+		}
+
+		// child = random solution of the subproblem
+		void solve_random(random_engine& generator, solution& child) const noexcept
+		{
+			solve(
+			  [&](const problem::instance& reduced_problem) noexcept {
+				  return uscp::random::solve(generator, reduced_problem, NULL_LOGGER);
+			  },
+			  child);
+		}
+
+		// child = greedy solution of the subproblem, subsets in reverse order if reversed
+		void solve_greedy(bool reversed, solution& child) const noexcept
+		{
+			solve(
+			  [&](const problem::instance& reduced_problem) noexcept {
+				  return greedy_solve(reduced_problem, reversed);
+			  },
+			  child);
+		}
+
+		// child = greedy solution of the subproblem improved by RWLS, see solve_greedy
+		void solve_rwls(bool reversed, random_engine& generator, solution& child) const noexcept
+		{
+			solve(
+			  [&](const problem::instance& reduced_problem) noexcept {
+				  const solution initial_solution = greedy_solve(reduced_problem, reversed);
+				  assert(initial_solution.cover_all_points);
+				  uscp::rwls::position stopping_criterion;
+				  stopping_criterion.steps =
+				    reduced_problem.subsets_number + reduced_problem.points_number;
+				  uscp::rwls::rwls rwls(reduced_problem, NULL_LOGGER);
+				  return rwls.improve(initial_solution, generator, stopping_criterion)
+				    .solution_final;
+			  },
+			  child);
+		}
+
+		// Subsets of the parents
+		[[nodiscard]] static dynamic_bitset<> parents_subsets(const solution& a,
+		                                                      const solution& b) noexcept
+		{
+			dynamic_bitset<> authorized_subsets = a.selected_subsets;
+			authorized_subsets |= b.selected_subsets;
+			return authorized_subsets;
+		}
+
+		// Subsets of the parents and of a random solution, to extend the subproblem
+		[[nodiscard]] static dynamic_bitset<> extended_parents_subsets(
+		  const solution& a,
+		  const solution& b,
+		  random_engine& generator) noexcept
+		{
+			const solution random_solution = uscp::random::solve(generator, a.problem, NULL_LOGGER);
+			dynamic_bitset<> authorized_subsets = random_solution.selected_subsets;
+			authorized_subsets |= a.selected_subsets;
+			authorized_subsets |= b.selected_subsets;
+			return authorized_subsets;
+		}
+
+	private:
+		[[nodiscard]] static solution greedy_solve(const problem::instance& reduced_problem,
+		                                           bool reversed) noexcept
+		{
+			return reversed ? uscp::greedy::rsolve(reduced_problem, NULL_LOGGER)
+			                : uscp::greedy::solve(reduced_problem, NULL_LOGGER);
+		}
+
+		void expand(const solution& reduced_solution, solution& child) const noexcept
+		{
+			uscp::expand(uscp::expand(reduced_solution), m_subsets_mapping, child);
+		}
+
+		std::vector<size_t> m_subsets_mapping;
+		problem::instance m_extracted_instance;
+		problem::instance m_reduced_instance;
+	};
+} // namespace uscp::crossover
+
+#endif //USCP_SUBPROBLEM_HPP
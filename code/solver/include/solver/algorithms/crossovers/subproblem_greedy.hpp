@@ -11,8 +11,7 @@
 #include "common/data/instance.hpp"
 #include "common/data/solution.hpp"
 #include "common/utils/random.hpp"
-#include "common/utils/logger.hpp"
-#include "solver/algorithms/greedy.hpp"
+#include "solver/algorithms/crossovers/subproblem.hpp"
 
 #include <dynamic_bitset.hpp>
 
@@ -30,22 +29,22 @@ namespace uscp::crossover
 		subproblem_greedy& operator=(const subproblem_greedy& other) = delete;
 		subproblem_greedy& operator=(subproblem_greedy&& other) noexcept = delete;
 
-		solution apply1(const solution& a,
-		                const solution& b,
-		                [[maybe_unused]] random_engine& generator) const noexcept
+		void apply1(const solution& a,
+		            const solution& b,
+		            [[maybe_unused]] random_engine& generator,
+		            solution& child) const noexcept
 		{
-			dynamic_bitset<> authorized_subsets = a.selected_subsets;
-			authorized_subsets |= b.selected_subsets;
-			return uscp::greedy::restricted_solve(problem, authorized_subsets, NULL_LOGGER);
+			const subproblem extracted(problem, subproblem::parents_subsets(a, b));
+			extracted.solve_greedy(false, child);
 		}
 
-		solution apply2(const solution& a,
-		                const solution& b,
-		                [[maybe_unused]] random_engine& generator) const noexcept
+		void apply2(const solution& a,
+		            const solution& b,
+		            [[maybe_unused]] random_engine& generator,
+		            solution& child) const noexcept
 		{
-			dynamic_bitset<> authorized_subsets = a.selected_subsets;
-			authorized_subsets |= b.selected_subsets;
-			return uscp::greedy::restricted_rsolve(problem, authorized_subsets, NULL_LOGGER);
+			const subproblem extracted(problem, subproblem::parents_subsets(a, b));
+			extracted.solve_greedy(true, child);
 		}
 
 		[[nodiscard]] static std::string_view to_string() noexcept
@@ -11,7 +11,7 @@
 #include "common/data/instance.hpp"
 #include "common/data/solution.hpp"
 #include "common/utils/random.hpp"
-#include "solver/algorithms/random.hpp"
+#include "solver/algorithms/crossovers/subproblem.hpp"
 
 #include <dynamic_bitset.hpp>
 
@@ -29,25 +29,29 @@ namespace uscp::crossover
 		subproblem_random& operator=(const subproblem_random& other) = delete;
 		subproblem_random& operator=(subproblem_random&& other) noexcept = delete;
 
-		solution apply(const solution& a, const solution& b, random_engine& generator) const
-		  noexcept
+		void apply(const solution& a,
+		           const solution& b,
+		           random_engine& generator,
+		           solution& child) const noexcept
 		{
-			dynamic_bitset<> authorized_subsets = a.selected_subsets;
-			authorized_subsets |= b.selected_subsets;
-			return uscp::random::restricted_solve(
-			  generator, problem, authorized_subsets, NULL_LOGGER);
+			const subproblem extracted(problem, subproblem::parents_subsets(a, b));
+			extracted.solve_random(generator, child);
 		}
 
-		solution apply1(const solution& a, const solution& b, random_engine& generator) const
-		  noexcept
+		void apply1(const solution& a,
+		            const solution& b,
+		            random_engine& generator,
+		            solution& child) const noexcept
 		{
-			return apply(a, b, generator);
+			apply(a, b, generator, child);
 		}
 
-		solution apply2(const solution& a, const solution& b, random_engine& generator) const
-		  noexcept
+		void apply2(const solution& a,
+		            const solution& b,
+		            random_engine& generator,
+		            solution& child) const noexcept
 		{
-			return apply(a, b, generator);
+			apply(a, b, generator, child);
 		}
 
 		[[nodiscard]] static std::string_view to_string() noexcept
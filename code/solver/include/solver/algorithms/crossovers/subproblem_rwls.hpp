@@ -11,9 +11,7 @@
 #include "common/data/instance.hpp"
 #include "common/data/solution.hpp"
 #include "common/utils/random.hpp"
-#include "common/utils/logger.hpp"
-#include "solver/algorithms/greedy.hpp"
-#include "solver/algorithms/rwls.hpp"
+#include "solver/algorithms/crossovers/subproblem.hpp"
 
 #include <dynamic_bitset.hpp>
 
@@ -23,77 +21,30 @@ namespace uscp::crossover
 {
 	struct subproblem_rwls final
 	{
-		explicit subproblem_rwls(const uscp::problem::instance& problem_)
-		  : problem(problem_), rwls(problem_, NULL_LOGGER)
+		explicit subproblem_rwls(const uscp::problem::instance& problem_): problem(problem_)
 		{
-			rwls.initialize();
-			stopping_criterion.steps = problem.subsets_number + problem.points_number;
-			subsets_covering_points.resize(problem.points_number);
-			for(size_t i = 0; i < problem.points_number; ++i)
-			{
-				subsets_covering_points[i].resize(problem.subsets_number);
-			}
-			for(size_t i = 0; i < problem.subsets_number; ++i)
-			{
-				problem.subsets_points[i].iterate_bits_on([&](size_t bit_on) noexcept {
-					assert(bit_on < subsets_covering_points.size());
-					assert(i < subsets_covering_points[bit_on].size());
-					subsets_covering_points[bit_on].set(i);
-				});
-			}
 		}
 		subproblem_rwls(const subproblem_rwls&) = default;
 		subproblem_rwls(subproblem_rwls&&) noexcept = default;
 		subproblem_rwls& operator=(const subproblem_rwls& other) = delete;
 		subproblem_rwls& operator=(subproblem_rwls&& other) noexcept = delete;
 
-		solution apply(solution solution,
-		               dynamic_bitset<> authorized_subsets,
-		               random_engine& generator)
+		void apply1(const solution& a,
+		            const solution& b,
+		            random_engine& generator,
+		            solution& child) const noexcept
 		{
-			// inclusion reduction for RWLS
-			dynamic_bitset<> tmp(problem.subsets_number);
-			dynamic_bitset<> included_subsets(problem.subsets_number);
-			for(size_t i = 0; i < problem.points_number; ++i)
-			{
-				tmp = subsets_covering_points[i];
-				tmp &= authorized_subsets;
-				assert(tmp.count() > 0);
-				if(tmp.count() == 1)
-				{
-					const size_t only_authorized_subset_covering = tmp.find_first();
-					included_subsets.set(only_authorized_subset_covering);
-				}
-			}
-			authorized_subsets -= included_subsets;
-			solution.selected_subsets |= included_subsets;
-
-			uscp::rwls::report report =
-			  rwls.restricted_improve(solution, generator, stopping_criterion, authorized_subsets);
-
-			return report.solution_final;
+			const subproblem extracted(problem, subproblem::parents_subsets(a, b));
+			extracted.solve_rwls(false, generator, child);
 		}
 
-		solution apply1(const solution& a, const solution& b, random_engine& generator) noexcept
+		void apply2(const solution& a,
+		            const solution& b,
+		            random_engine& generator,
+		            solution& child) const noexcept
 		{
-			dynamic_bitset<> authorized_subsets = a.selected_subsets;
-			authorized_subsets |= b.selected_subsets;
-			solution solution =
-			  uscp::greedy::restricted_solve(problem, authorized_subsets, NULL_LOGGER);
-			assert(solution.cover_all_points);
-
-			return apply(std::move(solution), std::move(authorized_subsets), generator);
-		}
-
-		solution apply2(const solution& a, const solution& b, random_engine& generator) noexcept
-		{
-			dynamic_bitset<> authorized_subsets = a.selected_subsets;
-			authorized_subsets |= b.selected_subsets;
-			solution solution =
-			  uscp::greedy::restricted_rsolve(problem, authorized_subsets, NULL_LOGGER);
-			assert(solution.cover_all_points);
-
-			return apply(std::move(solution), std::move(authorized_subsets), generator);
+			const subproblem extracted(problem, subproblem::parents_subsets(a, b));
+			extracted.solve_rwls(true, generator, child);
 		}
 
 		[[nodiscard]] static std::string_view to_string() noexcept
@@ -102,9 +53,6 @@ namespace uscp::crossover
 		}
 
 		const uscp::problem::instance& problem;
-		std::vector<dynamic_bitset<>> subsets_covering_points;
-		uscp::rwls::rwls rwls;
-		uscp::rwls::position stopping_criterion;
 	};
 } // namespace uscp::crossover
 
@@ -12,11 +12,15 @@
 #include "common/data/solution.hpp"
 #include "common/utils/random.hpp"
 #include "common/algorithms//memetic.hpp"
+#include "solver/algorithms/operators.hpp"
+#include "solver/algorithms/operators_selector.hpp"
+#include "solver/algorithms/redundancy.hpp"
 #include "solver/algorithms/rwls.hpp"
 
 #include <cstddef>
 #include <limits>
 #include <string>
+#include <vector>
 
 namespace uscp::memetic
 {
@@ -34,11 +38,30 @@ namespace uscp::memetic
 	{
 		position stopping_criterion;
 		uscp::rwls::position rwls_stopping_criterion;
+		bool prune_redundant = false; // prune redundant subsets of the solutions given to RWLS
+		uscp::redundancy::order prune_order = uscp::redundancy::order::largest;
+		size_t population_size = 2;     // individuals per island, rounded up to an even number
+		size_t islands = 1;             // 0: one island per population_size hardware threads
+		size_t migration_interval = 10; // generations between two migrations of the islands elites
+		bool steady_state = false; // asynchronous children in a single pool, generation = child
+		size_t outcomes_table_size = 64; // recent RWLS outcomes of children, 0 to disable
+		size_t target = 0; // stop once a solution has at most target subsets, 0 for no target
 
 		[[nodiscard]] config_serial serialize() const noexcept;
 		bool load(const config_serial& serial) noexcept;
 	};
 
+	struct operators_usage final
+	{
+		std::string crossover_operator;
+		std::string wcrossover_operator;
+		size_t children = 0;
+		double mean_reward = 0; // subsets improvement over the best parent
+
+		[[nodiscard]] operators_usage_serial serialize() const noexcept;
+		bool load(const operators_usage_serial& serial) noexcept;
+	};
+
 	struct report final
 	{
 		solution solution_final;
@@ -48,6 +71,9 @@ namespace uscp::memetic
 		config solve_config;
 		std::string crossover_operator;
 		std::string wcrossover_operator;
+		bool target_reached = false;
+		// operators pairs used with adaptive operators, most used first
+		std::vector<operators_usage> operators_selection;
 
 		explicit report(const problem::instance& problem) noexcept;
 		report(const report&) = default;
@@ -69,10 +95,30 @@ namespace uscp::memetic
 		memetic& operator=(const memetic& other) = delete;
 		memetic& operator=(memetic&& other) noexcept = delete;
 
-		[[gnu::hot]] void initialize() noexcept;
 		[[gnu::hot]] report solve(random_engine& generator, config config) noexcept;
 
 	private:
+		[[gnu::hot]] report solve_steady_state(random_engine& generator,
+		                                       const config& config) noexcept;
+
+		// Crossover and weights crossover of the operators pair, first or second child of parents
+		void apply_operators(size_t pair,
+		                     bool first_child,
+		                     const solution& parent1,
+		                     const solution& parent2,
+		                     const std::vector<long long>& parent1_weights,
+		                     const std::vector<long long>& parent2_weights,
+		                     random_engine& generator,
+		                     solution& child,
+		                     std::vector<long long>& child_weights) noexcept;
+
+		[[nodiscard]] static std::vector<operators_usage> operators_selection(
+		  const operators_selector& selector) noexcept;
+
+		// Operators pairs selected at runtime, a single pair with fixed operators
+		static constexpr size_t OPERATORS_PAIRS =
+		  operators_size<Crossover>::value * operators_size<WeightsCrossover>::value;
+
 		template<size_t v>
 		struct dependent_false : public std::false_type
 		{
@@ -82,7 +128,6 @@ namespace uscp::memetic
 		Crossover m_crossover;
 		WeightsCrossover m_wcrossover;
 		uscp::rwls::rwls m_rwls;
-		bool m_initialized;
 	};
 
 	[[nodiscard]] report expand(const report& reduced_report) noexcept;
@@ -14,10 +14,60 @@
 
 #include "common/utils/timer.hpp"
 #include "common/utils/logger.hpp"
+#include "solver/algorithms/outcomes.hpp"
 #include "solver/algorithms/random.hpp"
+#include "solver/algorithms/redundancy.hpp"
 #include "greedy.hpp"
 
-#include <array>
+#include <algorithm>
+#include <deque>
+#include <numeric>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#ifdef _OPENMP
+#	include <omp.h>
+#endif
+
+namespace uscp::memetic
+{
+	[[nodiscard]] inline size_t threads_number() noexcept
+	{
+#ifdef _OPENMP
+		return static_cast<size_t>(omp_get_max_threads());
+#else
+		return 1;
+#endif
+	}
+
+	[[nodiscard]] inline size_t thread_index() noexcept
+	{
+#ifdef _OPENMP
+		return static_cast<size_t>(omp_get_thread_num());
+#else
+		return 0;
+#endif
+	}
+
+	[[nodiscard]] inline bool target_reached(const config& config, size_t subsets_number) noexcept
+	{
+		return config.target != 0 && subsets_number <= config.target;
+	}
+
+	// Reward of the operators pair of a child: subsets improvement over its best parent
+	// Not divided by the RWLS steps: the children share the same dynamic steps, which don't measure
+	// the cost of an operators pair
+	[[nodiscard]] inline double operators_reward(size_t parents_subsets_number,
+	                                             size_t child_subsets_number) noexcept
+	{
+		if(child_subsets_number >= parents_subsets_number)
+		{
+			return 0;
+		}
+		return static_cast<double>(parents_subsets_number - child_subsets_number);
+	}
+} // namespace uscp::memetic
 
 template<typename Crossover, typename WeightsCrossover>
 uscp::memetic::memetic<Crossover, WeightsCrossover>::memetic(
@@ -26,15 +76,7 @@ uscp::memetic::memetic<Crossover, WeightsCrossover>::memetic(
   , m_crossover(problem)
   , m_wcrossover(problem)
   , m_rwls(problem, NULL_LOGGER)
-  , m_initialized(false)
-{
-}
-
-template<typename Crossover, typename WeightsCrossover>
-void uscp::memetic::memetic<Crossover, WeightsCrossover>::initialize() noexcept
 {
-	m_rwls.initialize();
-	m_initialized = true;
 }
 
 template<typename Crossover, typename WeightsCrossover>
@@ -47,15 +89,28 @@ uscp::memetic::report uscp::memetic::memetic<Crossover, WeightsCrossover>::solve
 	config.rwls_stopping_criterion.steps = std::numeric_limits<size_t>::max();
 	config.rwls_stopping_criterion.time = std::numeric_limits<double>::max();
 
-	if(!m_initialized)
+	// Islands populations are made of pairs of parents
+	config.population_size += config.population_size % 2;
+	config.population_size = std::max(config.population_size, size_t(2));
+	if(config.islands == 0)
 	{
-		initialize();
+		config.islands = std::max(
+		  static_cast<size_t>(std::thread::hardware_concurrency()) / config.population_size,
+		  size_t(1));
+	}
+	config.migration_interval = std::max(config.migration_interval, size_t(1));
+	m_rwls.set_target(config.target);
+	if(config.steady_state)
+	{
+		return solve_steady_state(generator, config);
 	}
 
-	LOGGER->info("({}) Start solving problem with memetic algorithm ({}/{})",
+	LOGGER->info("({}) Start solving problem with memetic algorithm ({}/{}, {}x{} individuals)",
 	             m_problem.name,
 	             Crossover::to_string(),
-	             WeightsCrossover::to_string());
+	             WeightsCrossover::to_string(),
+	             config.islands,
+	             config.population_size);
 
 	report report(m_problem);
 	report.solve_config = config;
@@ -64,28 +119,43 @@ uscp::memetic::report uscp::memetic::memetic<Crossover, WeightsCrossover>::solve
 
 	timer timer;
 
-	// Population weights
-	std::array<std::vector<long long>, 2> population_weights;
-	for(std::vector<long long>& weights: population_weights)
+	// Individuals of island i are stored in [i * population_size, (i + 1) * population_size)
+	const size_t individuals_number = config.islands * config.population_size;
+
+	// Individuals own random streams, results don't depend on threads number nor scheduling
+	const random_streams streams(generator);
+	std::vector<random_engine> generators;
+	generators.reserve(individuals_number);
+	for(size_t i = 0; i < individuals_number; ++i)
 	{
-		weights.resize(m_problem.points_number, 1);
+		generators.push_back(streams.stream(i));
 	}
 
+	// Population weights
+	std::vector<std::vector<long long>> population_weights(
+	  individuals_number, std::vector<long long>(m_problem.points_number, 1));
+
 	// Population
-	std::array<solution, 2> population{solution(m_problem), solution(m_problem)};
+	std::vector<solution> population(individuals_number, solution(m_problem));
 // OpenMP implementation changed in GCC9, see:
 // https://gcc.gnu.org/gcc-9/porting_to.html#ompdatasharing
 #if __GNUC__ < 9
-#	pragma omp parallel for default(none) shared(population, generator)
+#	pragma omp parallel for default(none) shared(population, generators, config)
 #else
-#	pragma omp parallel for default(none) shared(population, generator, NULL_LOGGER)
+#	pragma omp parallel for default(none) shared(population, generators, config, NULL_LOGGER)
 #endif
 	for(/*no size_t for openMP on Windows*/ int i_int = 0;
 	    i_int < static_cast<int>(population.size());
 	    ++i_int)
 	{
 		const size_t i = static_cast<size_t>(i_int);
-		population[i] = uscp::greedy::random_solve(generator, population[i].problem, NULL_LOGGER);
+		population[i] =
+		  uscp::greedy::random_solve(generators[i], population[i].problem, NULL_LOGGER);
+		if(config.prune_redundant)
+		{
+			uscp::redundancy::prune(
+			  config.prune_order, generators[i], population[i], NULL_LOGGER);
+		}
 	}
 	SPDLOG_LOGGER_DEBUG(
 	  LOGGER, "({}) Memetic population initialized in {}s", m_problem.name, timer.elapsed());
@@ -95,33 +165,66 @@ uscp::memetic::report uscp::memetic::memetic<Crossover, WeightsCrossover>::solve
 	rwls_cumulative_position.steps = 0;
 	rwls_cumulative_position.time = 0;
 	size_t best_solution_subsets_number = std::numeric_limits<size_t>::max();
-	std::array<uscp::rwls::report, 2> rwls_reports{uscp::rwls::report(m_problem),
-	                                               uscp::rwls::report(m_problem)};
+	std::vector<uscp::rwls::report> rwls_reports(individuals_number, uscp::rwls::report(m_problem));
 
 	// Best initial solution
 	{
-		const std::array<size_t, 2> initial_population_subsets_number = {
-		  population[0].selected_subsets.count(), population[1].selected_subsets.count()};
-		const size_t initial_population_best =
-		  initial_population_subsets_number[0] < initial_population_subsets_number[1] ? 0 : 1;
-		best_solution_subsets_number = initial_population_subsets_number[initial_population_best];
+		size_t initial_population_best = 0;
+		for(size_t i = 0; i < individuals_number; ++i)
+		{
+			const size_t solution_subsets_number = population[i].selected_subsets.count();
+			if(solution_subsets_number < best_solution_subsets_number)
+			{
+				best_solution_subsets_number = solution_subsets_number;
+				initial_population_best = i;
+			}
+		}
 		report.solution_final = population[initial_population_best];
 		report.found_at.generation = 0;
 		report.found_at.rwls_cumulative_position.steps = 0;
 		report.found_at.rwls_cumulative_position.time = 0;
 		report.found_at.time = timer.elapsed();
-		report.points_weights_final = rwls_reports[initial_population_best].points_weights_final;
+		report.points_weights_final = population_weights[initial_population_best];
+		report.target_reached = target_reached(config, best_solution_subsets_number);
 	}
 
-	// Dynamic steps setup
-	std::deque<size_t> dynamic_steps;
+	// Buffers reused by all generations
+	std::vector<uscp::rwls::rwls::resolution_data> rwls_data(
+	  threads_number(), uscp::rwls::rwls::resolution_data(m_problem));
+	std::vector<size_t> elites(config.islands);
+	std::vector<size_t> worsts(config.islands);
+	std::vector<solution> migrants(config.islands, solution(m_problem));
+	std::vector<std::vector<long long>> migrants_weights(config.islands);
+	std::vector<uint64_t> migrants_hashes(config.islands, 0);
+
+	// Duplicate children resume RWLS from their known outcome instead of redoing the same search
+	outcomes known_outcomes(m_problem, config.outcomes_table_size);
+	std::vector<uint64_t> children_hashes(individuals_number, 0);
+
+	// Operators pair of each child, rewarded once RWLS improved the child
+	static constexpr size_t NO_PAIR = std::numeric_limits<size_t>::max();
+	operators_selector selector(OPERATORS_PAIRS);
+	std::vector<size_t> children_pairs(individuals_number, NO_PAIR);
+	std::vector<size_t> children_parents_subsets(individuals_number, 0);
+
+	// Dynamic steps setup, each island adapts its own RWLS steps
+	struct island_state final
+	{
+		std::deque<size_t> dynamic_steps;
+		uscp::rwls::position rwls_stopping_criterion;
+	};
 	static constexpr size_t dynamic_steps_recorded_generations = 10;
 	const size_t base_steps = m_problem.subsets_number + m_problem.points_number;
-	dynamic_steps.resize(dynamic_steps_recorded_generations, base_steps);
 	config.rwls_stopping_criterion.steps = base_steps;
+	std::vector<island_state> islands(config.islands);
+	for(island_state& island: islands)
+	{
+		island.dynamic_steps.resize(dynamic_steps_recorded_generations, base_steps);
+		island.rwls_stopping_criterion = config.rwls_stopping_criterion;
+	}
 
 	// Main loop
-	while(generation < config.stopping_criterion.generation
+	while(!report.target_reached && generation < config.stopping_criterion.generation
 	      && rwls_cumulative_position < config.stopping_criterion.rwls_cumulative_position
 	      && timer.elapsed() < config.stopping_criterion.time)
 	{
@@ -129,15 +232,45 @@ uscp::memetic::report uscp::memetic::memetic<Crossover, WeightsCrossover>::solve
 		             m_problem.name,
 		             generation,
 		             timer.elapsed());
-#pragma omp parallel for default(none) \
-  shared(population, population_weights, rwls_reports, config, generator)
+		size_t resumed_children = 0;
+#pragma omp parallel for default(none) schedule(dynamic) reduction(+ : resumed_children) \
+  shared(population, population_weights, rwls_reports, rwls_data, islands, generators, config) \
+  shared(known_outcomes, children_hashes)
 		for(/*no size_t for openMP on Windows*/ int i_int = 0;
 		    i_int < static_cast<int>(population.size());
 		    ++i_int)
 		{
 			const size_t i = static_cast<size_t>(i_int);
-			rwls_reports[i] = m_rwls.improve(
-			  population[i], population_weights[i], generator, config.rwls_stopping_criterion);
+			children_hashes[i] = solution_hash(population[i]);
+			const outcomes::outcome* known = known_outcomes.find(children_hashes[i], population[i]);
+			if(known != nullptr)
+			{
+				++resumed_children;
+			}
+			m_rwls.improve(known != nullptr ? known->solution_final : population[i],
+			               known != nullptr ? known->points_weights_final : population_weights[i],
+			               generators[i],
+			               islands[i / config.population_size].rwls_stopping_criterion,
+			               rwls_data[thread_index()],
+			               rwls_reports[i]);
+		}
+		for(size_t i = 0; i < rwls_reports.size(); ++i)
+		{
+			known_outcomes.insert(children_hashes[i], population[i], rwls_reports[i]);
+			if(children_pairs[i] != NO_PAIR)
+			{
+				selector.update(
+				  children_pairs[i],
+				  operators_reward(children_parents_subsets[i],
+				                   rwls_reports[i].solution_final.selected_subsets.count()));
+			}
+		}
+		if(resumed_children > 0)
+		{
+			LOGGER->info("({}) M g{}: resumed RWLS of {} duplicate children from their outcome",
+			             m_problem.name,
+			             generation,
+			             resumed_children);
 		}
 		for(size_t i = 0; i < rwls_reports.size(); ++i)
 		{
@@ -161,10 +294,11 @@ uscp::memetic::report uscp::memetic::memetic<Crossover, WeightsCrossover>::solve
 				report.points_weights_final = rwls_reports[i].points_weights_final;
 				best_solution_subsets_number = solution_subsets_number;
 				LOGGER->info(
-				  "({}) Memetic new best solution with {} subsets at generation {} in {}s",
+				  "({}) Memetic new best solution with {} subsets at generation {} on island {} in {}s",
 				  m_problem.name,
 				  solution_subsets_number,
 				  generation,
+				  i / config.population_size,
 				  timer.elapsed());
 			}
 		}
@@ -172,111 +306,166 @@ uscp::memetic::report uscp::memetic::memetic<Crossover, WeightsCrossover>::solve
 		{
 			rwls_cumulative_position += rwls_reports[i].ended_at;
 		}
-		LOGGER->info("({}) M g{}: applied {} RWLS steps to get parents",
-		             m_problem.name,
-		             generation,
-		             config.rwls_stopping_criterion.steps);
-		LOGGER->info("({}) M g{}: parents found at: ({}, {})",
-		             m_problem.name,
-		             generation,
-		             rwls_reports[0].found_at.steps,
-		             rwls_reports[1].found_at.steps);
-		LOGGER->info("({}) M g{}: parents subsets: ({}, {}){}",
-		             m_problem.name,
-		             generation,
-		             rwls_reports[0].solution_final.selected_subsets.count(),
-		             rwls_reports[1].solution_final.selected_subsets.count(),
-		             rwls_reports[0].solution_final.selected_subsets
-		                 == rwls_reports[1].solution_final.selected_subsets
-		               ? " [same]"
-		               : "");
-
-		if(rwls_reports[0].found_at.steps == 0 || rwls_reports[1].found_at.steps == 0)
+		if(target_reached(config, best_solution_subsets_number))
 		{
-			LOGGER->info(
-			  "({}) M g{}: RWLS did not change the parents: randomize parents and double RWLS steps of next generation",
-			  m_problem.name,
-			  generation);
-			config.rwls_stopping_criterion.steps *= 2;
-			rwls_reports[0].solution_final = uscp::random::solve(generator, m_problem, NULL_LOGGER);
-			rwls_reports[1].solution_final = uscp::random::solve(generator, m_problem, NULL_LOGGER);
-			LOGGER->info("({}) M g{}: new parents subsets: ({}, {}){}",
+			LOGGER->info("({}) Memetic reached the target of {} subsets at generation {} in {}s",
 			             m_problem.name,
+			             config.target,
 			             generation,
-			             rwls_reports[0].solution_final.selected_subsets.count(),
-			             rwls_reports[1].solution_final.selected_subsets.count(),
-			             rwls_reports[0].solution_final.selected_subsets
-			                 == rwls_reports[1].solution_final.selected_subsets
-			               ? " [same]"
-			               : "");
+			             timer.elapsed());
+			report.target_reached = true;
+			break;
 		}
-		else
+
+		for(size_t island = 0; island < islands.size(); ++island)
 		{
-			if(rwls_reports[0].solution_final.selected_subsets
-			   == rwls_reports[1].solution_final.selected_subsets)
+			island_state& state = islands[island];
+			const size_t island_begin = island * config.population_size;
+			const size_t island_end = island_begin + config.population_size;
+			bool unchanged_parents = false;
+			size_t parents_steps = 0;
+			for(size_t i = island_begin; i < island_end; i += 2)
 			{
-				LOGGER->info(
-				  "({}) M g{}: same parents: randomize parents", m_problem.name, generation);
-				rwls_reports[0].solution_final =
-				  uscp::random::solve(generator, m_problem, NULL_LOGGER);
-				rwls_reports[1].solution_final =
-				  uscp::random::solve(generator, m_problem, NULL_LOGGER);
-				LOGGER->info("({}) M g{}: new parents subsets: ({}, {}){}",
-				             m_problem.name,
-				             generation,
-				             rwls_reports[0].solution_final.selected_subsets.count(),
-				             rwls_reports[1].solution_final.selected_subsets.count(),
-				             rwls_reports[0].solution_final.selected_subsets
-				                 == rwls_reports[1].solution_final.selected_subsets
-				               ? " [same]"
-				               : "");
+				uscp::rwls::report& parent1 = rwls_reports[i];
+				uscp::rwls::report& parent2 = rwls_reports[i + 1];
+				SPDLOG_LOGGER_DEBUG(LOGGER,
+				                    "({}) M g{} i{}: parents found at: ({}, {}), subsets: ({}, {})",
+				                    m_problem.name,
+				                    generation,
+				                    island,
+				                    parent1.found_at.steps,
+				                    parent2.found_at.steps,
+				                    parent1.solution_final.selected_subsets.count(),
+				                    parent2.solution_final.selected_subsets.count());
+				if(parent1.found_at.steps == 0 || parent2.found_at.steps == 0)
+				{
+					unchanged_parents = true;
+				}
+				else
+				{
+					parents_steps += parent1.found_at.steps + parent2.found_at.steps;
+					if(parent1.solution_final_hash != parent2.solution_final_hash
+					   || parent1.solution_final.selected_subsets
+					        != parent2.solution_final.selected_subsets)
+					{
+						continue;
+					}
+				}
+				parent1.solution_final = uscp::random::solve(generators[i], m_problem, NULL_LOGGER);
+				parent1.solution_final_hash = solution_hash(parent1.solution_final);
+				parent2.solution_final =
+				  uscp::random::solve(generators[i + 1], m_problem, NULL_LOGGER);
+				parent2.solution_final_hash = solution_hash(parent2.solution_final);
 			}
 
-			dynamic_steps.push_back(rwls_reports[0].found_at.steps
-			                        + rwls_reports[1].found_at.steps);
-			dynamic_steps.pop_front();
-			config.rwls_stopping_criterion.steps =
-			  base_steps
-			  + std::accumulate(std::begin(dynamic_steps), std::end(dynamic_steps), size_t(0))
-			      / dynamic_steps.size();
+			if(unchanged_parents)
+			{
+				LOGGER->info(
+				  "({}) M g{} i{}: RWLS did not change parents: randomize them and double RWLS steps of next generation",
+				  m_problem.name,
+				  generation,
+				  island);
+				state.rwls_stopping_criterion.steps *= 2;
+			}
+			else
+			{
+				state.dynamic_steps.push_back(parents_steps / (config.population_size / 2));
+				state.dynamic_steps.pop_front();
+				state.rwls_stopping_criterion.steps =
+				  base_steps
+				  + std::accumulate(
+				      std::begin(state.dynamic_steps), std::end(state.dynamic_steps), size_t(0))
+				      / state.dynamic_steps.size();
+			}
 		}
 
-#pragma omp parallel sections
+		// Migration: the elite of each island replaces the worst parent of the next island
+		if(islands.size() > 1 && (generation + 1) % config.migration_interval == 0)
 		{
-#pragma omp section
+			for(size_t island = 0; island < islands.size(); ++island)
 			{
-				population[0] = m_crossover.apply1(
-				  rwls_reports[0].solution_final, rwls_reports[1].solution_final, generator);
+				const size_t island_begin = island * config.population_size;
+				size_t elite_subsets_number = std::numeric_limits<size_t>::max();
+				size_t worst_subsets_number = 0;
+				for(size_t i = island_begin; i < island_begin + config.population_size; ++i)
+				{
+					const size_t subsets_number =
+					  rwls_reports[i].solution_final.selected_subsets.count();
+					if(subsets_number < elite_subsets_number)
+					{
+						elite_subsets_number = subsets_number;
+						elites[island] = i;
+					}
+					if(subsets_number >= worst_subsets_number)
+					{
+						worst_subsets_number = subsets_number;
+						worsts[island] = i;
+					}
+				}
+			}
+			for(size_t island = 0; island < islands.size(); ++island)
+			{
+				migrants[island] = rwls_reports[elites[island]].solution_final;
+				migrants_weights[island] = rwls_reports[elites[island]].points_weights_final;
+				migrants_hashes[island] = rwls_reports[elites[island]].solution_final_hash;
 			}
-#pragma omp section
+			for(size_t island = 0; island < islands.size(); ++island)
 			{
-				population[1] = m_crossover.apply2(
-				  rwls_reports[0].solution_final, rwls_reports[1].solution_final, generator);
+				uscp::rwls::report& target = rwls_reports[worsts[(island + 1) % islands.size()]];
+				target.solution_final = migrants[island];
+				target.points_weights_final = migrants_weights[island];
+				target.solution_final_hash = migrants_hashes[island];
 			}
+			LOGGER->info("({}) M g{}: migrated islands elites", m_problem.name, generation);
 		}
-		LOGGER->info("({}) M g{}: children subsets: ({}, {}){}",
-		             m_problem.name,
-		             generation,
-		             population[0].selected_subsets.count(),
-		             population[1].selected_subsets.count(),
-		             population[0].selected_subsets == population[1].selected_subsets ? " [same]"
-		                                                                              : "");
 
-#pragma omp parallel sections
+		// Selection before the parallel crossovers, results don't depend on scheduling
+		for(size_t i = 0; i < individuals_number; ++i)
 		{
-#pragma omp section
-			{
-				population_weights[0] = m_wcrossover.apply1(rwls_reports[0].points_weights_final,
-				                                            rwls_reports[0].points_weights_final,
-				                                            generator);
-			}
-#pragma omp section
+			children_pairs[i] = selector.select();
+			children_parents_subsets[i] =
+			  std::min(rwls_reports[i - i % 2].solution_final.selected_subsets.count(),
+			           rwls_reports[i - i % 2 + 1].solution_final.selected_subsets.count());
+		}
+
+		size_t pruned_subsets = 0;
+#if __GNUC__ < 9
+#	pragma omp parallel for default(none) schedule(dynamic) reduction(+ : pruned_subsets) \
+	  shared(population, population_weights, rwls_reports, generators, config, children_pairs)
+#else
+#	pragma omp parallel for default(none) schedule(dynamic) reduction(+ : pruned_subsets) \
+	  shared(population, population_weights, rwls_reports, generators, config, NULL_LOGGER) \
+	  shared(children_pairs)
+#endif
+		for(/*no size_t for openMP on Windows*/ int i_int = 0;
+		    i_int < static_cast<int>(population.size());
+		    ++i_int)
+		{
+			const size_t i = static_cast<size_t>(i_int);
+			const uscp::rwls::report& parent1 = rwls_reports[i - i % 2];
+			const uscp::rwls::report& parent2 = rwls_reports[i - i % 2 + 1];
+			apply_operators(children_pairs[i],
+			                i % 2 == 0,
+			                parent1.solution_final,
+			                parent2.solution_final,
+			                parent1.points_weights_final,
+			                parent2.points_weights_final,
+			                generators[i],
+			                population[i],
+			                population_weights[i]);
+			if(config.prune_redundant)
 			{
-				population_weights[1] = m_wcrossover.apply2(rwls_reports[0].points_weights_final,
-				                                            rwls_reports[0].points_weights_final,
-				                                            generator);
+				pruned_subsets += uscp::redundancy::prune(
+				  config.prune_order, generators[i], population[i], NULL_LOGGER);
 			}
 		}
+		if(pruned_subsets > 0)
+		{
+			LOGGER->info("({}) M g{}: pruned {} redundant subsets from children",
+			             m_problem.name,
+			             generation,
+			             pruned_subsets);
+		}
 		LOGGER->info("({}) M g{}: current best solution subsets number: {}",
 		             m_problem.name,
 		             generation,
@@ -288,6 +477,10 @@ uscp::memetic::report uscp::memetic::memetic<Crossover, WeightsCrossover>::solve
 	report.ended_at.generation = generation;
 	report.ended_at.rwls_cumulative_position = rwls_cumulative_position;
 	report.ended_at.time = timer.elapsed();
+	if constexpr(OPERATORS_PAIRS > 1)
+	{
+		report.operators_selection = operators_selection(selector);
+	}
 
 	LOGGER->info("({}) Memetic found solution with {} subsets in {}s",
 	             m_problem.name,
@@ -297,4 +490,364 @@ uscp::memetic::report uscp::memetic::memetic<Crossover, WeightsCrossover>::solve
 	return report;
 }
 
+template<typename Crossover, typename WeightsCrossover>
+uscp::memetic::report uscp::memetic::memetic<Crossover, WeightsCrossover>::solve_steady_state(
+  uscp::random_engine& generator,
+  const uscp::memetic::config& config) noexcept
+{
+	// Single pool of all islands individuals, migrations are meaningless without islands
+	const size_t population_size = config.islands * config.population_size;
+
+	LOGGER->info(
+	  "({}) Start solving problem with steady-state memetic algorithm ({}/{}, {} individuals)",
+	  m_problem.name,
+	  Crossover::to_string(),
+	  WeightsCrossover::to_string(),
+	  population_size);
+
+	report report(m_problem);
+	report.solve_config = config;
+	report.crossover_operator = m_crossover.to_string();
+	report.wcrossover_operator = m_wcrossover.to_string();
+
+	timer timer;
+
+	// Individual i uses stream i, child c uses stream population_size + c
+	const random_streams streams(generator);
+
+	// Population, improved by RWLS to get the weights of each individual
+	const size_t base_steps = m_problem.subsets_number + m_problem.points_number;
+	uscp::rwls::position rwls_stopping_criterion = config.rwls_stopping_criterion;
+	rwls_stopping_criterion.steps = base_steps;
+	std::vector<uscp::rwls::report> population(population_size, uscp::rwls::report(m_problem));
+	// https://gcc.gnu.org/gcc-9/porting_to.html#ompdatasharing
+#if __GNUC__ < 9
+#	pragma omp parallel for default(none) schedule(dynamic) \
+	  shared(population, config, rwls_stopping_criterion)
+#else
+#	pragma omp parallel for default(none) schedule(dynamic) \
+	  shared(population, streams, config, rwls_stopping_criterion, NULL_LOGGER)
+#endif
+	for(/*no size_t for openMP on Windows*/ int i_int = 0;
+	    i_int < static_cast<int>(population.size());
+	    ++i_int)
+	{
+		const size_t i = static_cast<size_t>(i_int);
+		random_engine individual_generator = streams.stream(i);
+		solution individual =
+		  uscp::greedy::random_solve(individual_generator, m_problem, NULL_LOGGER);
+		if(config.prune_redundant)
+		{
+			uscp::redundancy::prune(
+			  config.prune_order, individual_generator, individual, NULL_LOGGER);
+		}
+		population[i] = m_rwls.improve(individual, individual_generator, rwls_stopping_criterion);
+	}
+
+	uscp::rwls::position rwls_cumulative_position;
+	rwls_cumulative_position.steps = 0;
+	rwls_cumulative_position.time = 0;
+	size_t best_solution_subsets_number = std::numeric_limits<size_t>::max();
+	for(const uscp::rwls::report& individual: population)
+	{
+		rwls_cumulative_position += individual.ended_at;
+		const size_t solution_subsets_number = individual.solution_final.selected_subsets.count();
+		if(solution_subsets_number < best_solution_subsets_number)
+		{
+			best_solution_subsets_number = solution_subsets_number;
+			report.solution_final = individual.solution_final;
+			report.points_weights_final = individual.points_weights_final;
+		}
+	}
+	report.found_at.generation = 0;
+	report.found_at.rwls_cumulative_position = rwls_cumulative_position;
+	report.found_at.time = timer.elapsed();
+	report.target_reached = target_reached(config, best_solution_subsets_number);
+	SPDLOG_LOGGER_DEBUG(
+	  LOGGER, "({}) Memetic population initialized in {}s", m_problem.name, timer.elapsed());
+
+	// Dynamic steps setup, a child not improved by RWLS counts as using all its steps
+	std::deque<size_t> dynamic_steps;
+	static constexpr size_t dynamic_steps_recorded_children = 10;
+	dynamic_steps.resize(dynamic_steps_recorded_children, base_steps);
+
+	// Workers: each thread creates children from the pool until the stopping criterion is met,
+	// the pool is only locked to pick the parents and to insert the child
+	size_t children = 0;
+	size_t inserted_children = 0;
+	size_t resumed_children = 0;
+	outcomes known_outcomes(m_problem, config.outcomes_table_size);
+	operators_selector selector(OPERATORS_PAIRS);
+	// https://gcc.gnu.org/gcc-9/porting_to.html#ompdatasharing
+#if __GNUC__ < 9
+#	pragma omp parallel default(none) \
+	  shared(report, config, timer, rwls_stopping_criterion, rwls_cumulative_position) \
+	  shared(population, children, inserted_children, resumed_children, known_outcomes, selector) \
+	  shared(dynamic_steps, best_solution_subsets_number)
+#else
+#	pragma omp parallel default(none) \
+	  shared(report, config, timer, rwls_stopping_criterion, rwls_cumulative_position) \
+	  shared(population, children, inserted_children, resumed_children, known_outcomes, selector) \
+	  shared(dynamic_steps, best_solution_subsets_number, streams, population_size, base_steps) \
+	  shared(LOGGER, NULL_LOGGER)
+#endif
+	{
+		solution parent1(m_problem);
+		solution parent2(m_problem);
+		std::vector<long long> parent1_weights;
+		std::vector<long long> parent2_weights;
+		solution child_solution(m_problem);
+		std::vector<long long> child_weights;
+		solution known_solution(m_problem);
+		std::vector<long long> known_weights;
+		uscp::rwls::rwls::resolution_data child_data(m_problem);
+		uscp::rwls::report child_report(m_problem);
+		uscp::rwls::position child_stopping_criterion;
+		while(true)
+		{
+			bool stop = false;
+			size_t child = 0;
+			size_t child_pair = 0;
+			size_t parents_subsets_number = 0;
+			random_engine child_generator;
+#pragma omp critical(uscp_memetic_pool)
+			{
+				stop =
+				  report.target_reached
+				  || !(rwls_cumulative_position < config.stopping_criterion.rwls_cumulative_position
+				       && timer.elapsed() < config.stopping_criterion.time);
+				if(!stop)
+				{
+					child = children++;
+					child_generator = streams.stream(population_size + child);
+					child_stopping_criterion = rwls_stopping_criterion;
+
+					// Two distinct parents
+					std::uniform_int_distribution<size_t> parent_dist(0, population_size - 1);
+					const size_t parent1_index = parent_dist(child_generator);
+					size_t parent2_index = parent_dist(child_generator);
+					if(parent2_index == parent1_index)
+					{
+						parent2_index = (parent2_index + 1) % population_size;
+					}
+					parent1 = population[parent1_index].solution_final;
+					parent2 = population[parent2_index].solution_final;
+					parent1_weights = population[parent1_index].points_weights_final;
+					parent2_weights = population[parent2_index].points_weights_final;
+					parents_subsets_number =
+					  std::min(parent1.selected_subsets.count(), parent2.selected_subsets.count());
+					child_pair = selector.select();
+				}
+			}
+			if(stop)
+			{
+				break;
+			}
+
+			apply_operators(child_pair,
+			                child % 2 == 0,
+			                parent1,
+			                parent2,
+			                parent1_weights,
+			                parent2_weights,
+			                child_generator,
+			                child_solution,
+			                child_weights);
+			if(config.prune_redundant)
+			{
+				uscp::redundancy::prune(
+				  config.prune_order, child_generator, child_solution, NULL_LOGGER);
+			}
+
+			// Duplicate child: resume the search from its known outcome
+			const uint64_t child_hash = solution_hash(child_solution);
+			bool known = false;
+			if(known_outcomes.enabled())
+			{
+#pragma omp critical(uscp_memetic_pool)
+				{
+					const outcomes::outcome* outcome =
+					  known_outcomes.find(child_hash, child_solution);
+					if(outcome != nullptr)
+					{
+						known_solution = outcome->solution_final;
+						known_weights = outcome->points_weights_final;
+						known = true;
+						++resumed_children;
+					}
+				}
+			}
+			m_rwls.improve(known ? known_solution : child_solution,
+			               known ? known_weights : child_weights,
+			               child_generator,
+			               child_stopping_criterion,
+			               child_data,
+			               child_report);
+			const size_t child_subsets_number =
+			  child_report.solution_final.selected_subsets.count();
+
+#pragma omp critical(uscp_memetic_pool)
+			{
+				known_outcomes.insert(child_hash, child_solution, child_report);
+				selector.update(child_pair,
+				                operators_reward(parents_subsets_number, child_subsets_number));
+				const uscp::rwls::position child_found_at =
+				  rwls_cumulative_position + child_report.found_at;
+				rwls_cumulative_position += child_report.ended_at;
+
+				dynamic_steps.push_back(child_report.found_at.steps == 0
+				                          ? child_stopping_criterion.steps
+				                          : child_report.found_at.steps);
+				dynamic_steps.pop_front();
+				rwls_stopping_criterion.steps =
+				  base_steps
+				  + std::accumulate(std::begin(dynamic_steps), std::end(dynamic_steps), size_t(0))
+				      / dynamic_steps.size();
+
+				if(child_subsets_number < best_solution_subsets_number)
+				{
+					child_report.solution_final.compute_cover();
+					assert(child_report.solution_final.cover_all_points);
+					if(!child_report.solution_final.cover_all_points)
+					{
+						LOGGER->error("Memetic new best solution doesn't cover all points");
+						abort();
+					}
+
+					report.solution_final = child_report.solution_final;
+					report.found_at.generation = child;
+					report.found_at.rwls_cumulative_position = child_found_at;
+					report.found_at.time = timer.elapsed();
+					report.points_weights_final = child_report.points_weights_final;
+					best_solution_subsets_number = child_subsets_number;
+					LOGGER->info(
+					  "({}) Memetic new best solution with {} subsets at child {} in {}s",
+					  m_problem.name,
+					  child_subsets_number,
+					  child,
+					  timer.elapsed());
+					if(target_reached(config, child_subsets_number))
+					{
+						LOGGER->info("({}) Memetic reached the target of {} subsets at child {}",
+						             m_problem.name,
+						             config.target,
+						             child);
+						report.target_reached = true;
+					}
+				}
+
+				// Replacement: the child replaces the worst individual if it isn't worse and is
+				// not already in the population
+				size_t worst = 0;
+				size_t worst_subsets_number = 0;
+				bool duplicate = false;
+				for(size_t i = 0; i < population_size; ++i)
+				{
+					const size_t subsets_number =
+					  population[i].solution_final.selected_subsets.count();
+					if(population[i].solution_final_hash == child_report.solution_final_hash
+					   && population[i].solution_final.selected_subsets
+					        == child_report.solution_final.selected_subsets)
+					{
+						duplicate = true;
+						break;
+					}
+					if(subsets_number >= worst_subsets_number)
+					{
+						worst_subsets_number = subsets_number;
+						worst = i;
+					}
+				}
+				if(!duplicate && child_subsets_number <= worst_subsets_number)
+				{
+					// swap to keep the buffers of the replaced individual for the next child
+					std::swap(population[worst], child_report);
+					++inserted_children;
+				}
+			}
+		}
+	}
+
+	report.ended_at.generation = children;
+	report.ended_at.rwls_cumulative_position = rwls_cumulative_position;
+	report.ended_at.time = timer.elapsed();
+	if constexpr(OPERATORS_PAIRS > 1)
+	{
+		report.operators_selection = operators_selection(selector);
+	}
+
+	LOGGER->info(
+	  "({}) Memetic inserted {} of {} children in the population, resumed {} duplicate children",
+	  m_problem.name,
+	  inserted_children,
+	  children,
+	  resumed_children);
+	LOGGER->info("({}) Memetic found solution with {} subsets in {}s",
+	             m_problem.name,
+	             report.solution_final.selected_subsets.count(),
+	             timer.elapsed());
+
+	return report;
+}
+
+template<typename Crossover, typename WeightsCrossover>
+void uscp::memetic::memetic<Crossover, WeightsCrossover>::apply_operators(
+  size_t pair,
+  bool first_child,
+  const uscp::solution& parent1,
+  const uscp::solution& parent2,
+  const std::vector<long long>& parent1_weights,
+  const std::vector<long long>& parent2_weights,
+  uscp::random_engine& generator,
+  uscp::solution& child,
+  std::vector<long long>& child_weights) noexcept
+{
+	assert(pair < OPERATORS_PAIRS);
+	const size_t wcrossovers_number = operators_size<WeightsCrossover>::value;
+	apply_operator(
+	  m_crossover, pair / wcrossovers_number, first_child, parent1, parent2, generator, child);
+	apply_operator(m_wcrossover,
+	               pair % wcrossovers_number,
+	               first_child,
+	               parent1_weights,
+	               parent2_weights,
+	               generator,
+	               child_weights);
+}
+
+template<typename Crossover, typename WeightsCrossover>
+std::vector<uscp::memetic::operators_usage> uscp::memetic::memetic<Crossover, WeightsCrossover>::
+  operators_selection(const uscp::memetic::operators_selector& selector) noexcept
+{
+	const size_t wcrossovers_number = operators_size<WeightsCrossover>::value;
+	std::vector<operators_usage> selection;
+	for(size_t pair = 0; pair < selector.arms(); ++pair)
+	{
+		if(selector.uses(pair) == 0)
+		{
+			continue;
+		}
+		operators_usage usage;
+		usage.crossover_operator = operator_name<Crossover>(pair / wcrossovers_number);
+		usage.wcrossover_operator = operator_name<WeightsCrossover>(pair % wcrossovers_number);
+		usage.children = selector.uses(pair);
+		usage.mean_reward = selector.mean_reward(pair);
+		selection.push_back(std::move(usage));
+	}
+	std::stable_sort(std::begin(selection),
+	                 std::end(selection),
+	                 [](const operators_usage& a, const operators_usage& b) noexcept {
+		                 return a.children > b.children;
+	                 });
+	if(!selection.empty())
+	{
+		LOGGER->info("Memetic most selected operators: {}/{} for {} children ({} subsets gained)",
+		             selection.front().crossover_operator,
+		             selection.front().wcrossover_operator,
+		             selection.front().children,
+		             selection.front().mean_reward);
+	}
+	return selection;
+}
+
 #endif //USCP_MEMETIC_TPP
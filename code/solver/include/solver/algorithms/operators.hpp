@@ -0,0 +1,171 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#ifndef USCP_OPERATORS_HPP
+#define USCP_OPERATORS_HPP
+
+#include "common/data/instance.hpp"
+
+#include <cstddef>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace uscp::memetic
+{
+	// All Operators... available at runtime, an operator is applied by its index in Operators...
+	// Used as crossover or weights crossover of the memetic algorithm to select the operators pair
+	// of each child during the resolution
+	template<typename... Operators>
+	class operators final
+	{
+	public:
+		explicit operators(const problem::instance& problem) noexcept
+		  : m_operators(Operators(problem)...)
+		{
+		}
+		operators(const operators&) = default;
+		operators(operators&&) noexcept = default;
+		operators& operator=(const operators& other) = delete;
+		operators& operator=(operators&& other) noexcept = delete;
+
+		template<typename... Args>
+		void apply1(size_t index, Args&&... args) noexcept
+		{
+			visit(index, [&](auto& op) noexcept {
+				op.apply1(std::forward<Args>(args)...);
+			});
+		}
+
+		template<typename... Args>
+		void apply2(size_t index, Args&&... args) noexcept
+		{
+			visit(index, [&](auto& op) noexcept {
+				op.apply2(std::forward<Args>(args)...);
+			});
+		}
+
+		[[nodiscard]] static constexpr size_t size() noexcept
+		{
+			return sizeof...(Operators);
+		}
+
+		[[nodiscard]] static std::string_view to_string(size_t index) noexcept
+		{
+			std::string_view name;
+			visit_types(index, [&](auto op) noexcept {
+				name = decltype(op)::type::to_string();
+			});
+			return name;
+		}
+
+		[[nodiscard]] static std::string_view to_string() noexcept
+		{
+			return "adaptive";
+		}
+
+	private:
+		template<typename Operator>
+		struct type_tag final
+		{
+			typedef Operator type;
+		};
+
+		template<typename Function>
+		void visit(size_t index, Function&& function) noexcept
+		{
+			visit(index, std::forward<Function>(function), std::index_sequence_for<Operators...>{});
+		}
+
+		template<typename Function, size_t... Indexes>
+		void visit(size_t index, Function&& function, std::index_sequence<Indexes...>) noexcept
+		{
+			((index == Indexes ? (function(std::get<Indexes>(m_operators)), true) : false) || ...);
+		}
+
+		template<typename Function>
+		static void visit_types(size_t index, Function&& function) noexcept
+		{
+			size_t i = 0;
+			((i++ == index ? (function(type_tag<Operators>{}), true) : false) || ...);
+		}
+
+		std::tuple<Operators...> m_operators;
+	};
+
+	template<typename Operator>
+	struct is_operators : std::false_type
+	{
+	};
+
+	template<typename... Operators>
+	struct is_operators<operators<Operators...>> : std::true_type
+	{
+	};
+
+	// Number of operators of a crossover or weights crossover: 1 for a single operator
+	template<typename Operator>
+	struct operators_size : std::integral_constant<size_t, 1>
+	{
+	};
+
+	template<typename... Operators>
+	struct operators_size<operators<Operators...>>
+	  : std::integral_constant<size_t, sizeof...(Operators)>
+	{
+	};
+
+	// Operator of index index of a crossover or weights crossover, first or second child
+	template<typename Operator, typename... Args>
+	void apply_operator(Operator& op,
+	                    [[maybe_unused]] size_t index,
+	                    bool first_child,
+	                    Args&&... args) noexcept
+	{
+		if(first_child)
+		{
+			op.apply1(std::forward<Args>(args)...);
+		}
+		else
+		{
+			op.apply2(std::forward<Args>(args)...);
+		}
+	}
+
+	template<typename... Operators, typename... Args>
+	void apply_operator(operators<Operators...>& op,
+	                    size_t index,
+	                    bool first_child,
+	                    Args&&... args) noexcept
+	{
+		if(first_child)
+		{
+			op.apply1(index, std::forward<Args>(args)...);
+		}
+		else
+		{
+			op.apply2(index, std::forward<Args>(args)...);
+		}
+	}
+
+	// Name of the operator of index index of a crossover or weights crossover
+	template<typename Operator>
+	[[nodiscard]] std::string_view operator_name([[maybe_unused]] size_t index) noexcept
+	{
+		if constexpr(is_operators<Operator>::value)
+		{
+			return Operator::to_string(index);
+		}
+		else
+		{
+			return Operator::to_string();
+		}
+	}
+} // namespace uscp::memetic
+
+#endif //USCP_OPERATORS_HPP
@@ -0,0 +1,50 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#ifndef USCP_OPERATORS_SELECTOR_HPP
+#define USCP_OPERATORS_SELECTOR_HPP
+
+#include <cstddef>
+#include <vector>
+
+namespace uscp::memetic
+{
+	// UCB1 bandit over the operators pairs (arms) of the memetic algorithm, an arm is rewarded
+	// with the subsets improvement of the children it created
+	class operators_selector final
+	{
+	public:
+		explicit operators_selector(size_t arms) noexcept;
+		operators_selector(const operators_selector&) = default;
+		operators_selector(operators_selector&&) noexcept = default;
+		operators_selector& operator=(const operators_selector& other) = default;
+		operators_selector& operator=(operators_selector&& other) noexcept = default;
+
+		// Arm of the next child: each arm once, then the arm with the best upper confidence bound
+		// A selected arm counts as used with no reward until its update, so that the children of
+		// a generation are spread over the arms
+		[[nodiscard]] size_t select() noexcept;
+
+		void update(size_t arm, double reward) noexcept;
+
+		[[nodiscard]] size_t arms() const noexcept;
+		[[nodiscard]] size_t uses(size_t arm) const noexcept;
+		[[nodiscard]] double mean_reward(size_t arm) const noexcept;
+
+	private:
+		struct arm_state final
+		{
+			size_t uses = 0;
+			double rewards = 0;
+		};
+
+		std::vector<arm_state> m_arms;
+		size_t m_uses;
+	};
+} // namespace uscp::memetic
+
+#endif //USCP_OPERATORS_SELECTOR_HPP
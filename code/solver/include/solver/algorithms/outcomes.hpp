@@ -0,0 +1,64 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#ifndef USCP_OUTCOMES_HPP
+#define USCP_OUTCOMES_HPP
+
+#include "common/data/instance.hpp"
+#include "common/data/solution.hpp"
+#include "solver/algorithms/rwls.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace uscp::memetic
+{
+	// Bounded table of recent RWLS outcomes, indexed by the hash of the solution RWLS started from
+	// Direct-mapped: an outcome replaces the one of another solution with the same slot
+	class outcomes final
+	{
+	public:
+		struct outcome final
+		{
+			solution solution_final;
+			std::vector<long long> points_weights_final;
+
+			explicit outcome(const problem::instance& problem) noexcept;
+		};
+
+		outcomes(const problem::instance& problem, size_t size) noexcept;
+		outcomes(const outcomes&) = default;
+		outcomes(outcomes&&) noexcept = default;
+		outcomes& operator=(const outcomes& other) = delete;
+		outcomes& operator=(outcomes&& other) noexcept = delete;
+
+		// Outcome of an RWLS run started from solution, nullptr if unknown
+		[[nodiscard]] const outcome* find(uint64_t hash, const solution& solution) const noexcept;
+
+		void insert(uint64_t hash,
+		            const solution& solution,
+		            const uscp::rwls::report& report) noexcept;
+
+		[[nodiscard]] bool enabled() const noexcept;
+
+	private:
+		struct entry final
+		{
+			bool used = false;
+			uint64_t hash = 0;
+			dynamic_bitset<> selected_subsets;
+			outcome result;
+
+			explicit entry(const problem::instance& problem) noexcept;
+		};
+
+		std::vector<entry> m_entries;
+	};
+} // namespace uscp::memetic
+
+#endif //USCP_OUTCOMES_HPP
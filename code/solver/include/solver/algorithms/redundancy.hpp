@@ -0,0 +1,49 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#ifndef USCP_REDUNDANCY_HPP
+#define USCP_REDUNDANCY_HPP
+
+#include "common/data/solution.hpp"
+#include "common/utils/random.hpp"
+#include "common/utils/logger.hpp"
+
+#include <cstddef>
+#include <string_view>
+
+namespace uscp::redundancy
+{
+	// Order in which the selected subsets are considered for removal
+	enum class order
+	{
+		largest,
+		random,
+	};
+
+	[[nodiscard]] std::string_view to_string(order order) noexcept;
+	bool from_string(std::string_view name, order& order) noexcept;
+
+	// Remove the selected subsets whose points are all covered at least twice, the covered points
+	// are left unchanged, return the number of subsets removed
+
+	// Largest subsets are considered first
+	[[gnu::hot]] size_t prune(solution& solution,
+	                          std::shared_ptr<spdlog::logger> logger = LOGGER) noexcept;
+
+	// Subsets are considered in a random order
+	[[gnu::hot]] size_t random_prune(random_engine& generator,
+	                                 solution& solution,
+	                                 std::shared_ptr<spdlog::logger> logger = LOGGER) noexcept;
+
+	// Subsets are considered in order, generator is only used by the random order
+	[[gnu::hot]] size_t prune(order order,
+	                          random_engine& generator,
+	                          solution& solution,
+	                          std::shared_ptr<spdlog::logger> logger = LOGGER) noexcept;
+} // namespace uscp::redundancy
+
+#endif //USCP_REDUNDANCY_HPP
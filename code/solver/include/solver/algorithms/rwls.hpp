@@ -17,6 +17,7 @@
 #include <nlohmann/json.hpp>
 
 #include <cstddef>
+#include <cstdint>
 #include <limits>
 #include <deque>
 #include <vector>
@@ -50,6 +51,9 @@ namespace uscp::rwls
 		position found_at;
 		position ended_at;
 		position stopping_criterion;
+		uint64_t solution_final_hash = 0; // solution_hash(solution_final), not serialized
+		size_t target = 0; // 0 for no target
+		bool target_reached = false;
 
 		explicit report(const problem::instance& problem) noexcept;
 		report(const report&) = default;
@@ -63,7 +67,37 @@ namespace uscp::rwls
 
 	class rwls final
 	{
+		struct point_information final // row
+		{
+			long long weight = 1;
+			size_t subsets_covering_in_solution = 0;
+		};
+
+		struct subset_information final // column
+		{
+			long long score = 0;
+			long long timestamp = 1;
+			bool canAddToSolution = true;
+		};
+
 	public:
+		// Resolution buffers, can be reused by successive improvements on the same instance
+		struct resolution_data final
+		{
+			random_engine* generator = nullptr;
+			solution* best_solution = nullptr;
+			solution current_solution;
+			uint64_t current_solution_hash = 0;
+			dynamic_bitset<> uncovered_points; // RWLS name: L
+			std::vector<point_information> points_information;
+			std::vector<subset_information> subsets_information;
+			std::deque<size_t> tabu_subsets;
+
+			dynamic_bitset<> subsets_tmp;
+
+			explicit resolution_data(const problem::instance& problem) noexcept;
+		};
+
 		explicit rwls(const problem::instance& problem,
 		              std::shared_ptr<spdlog::logger> logger = LOGGER) noexcept;
 		rwls(const rwls&) = default;
@@ -71,7 +105,9 @@ namespace uscp::rwls
 		rwls& operator=(const rwls& other) = delete;
 		rwls& operator=(rwls&& other) noexcept = delete;
 
-		[[gnu::hot]] void initialize() noexcept;
+		// Stop as soon as a solution with at most target subsets is found, 0 for no target
+		void set_target(size_t target) noexcept;
+
 		[[nodiscard, gnu::hot]] report improve(const uscp::solution& solution,
 		                                       random_engine& generator,
 		                                       position stopping_criterion) noexcept;
@@ -94,42 +130,32 @@ namespace uscp::rwls
 		  position stopping_criterion,
 		  const dynamic_bitset<>& authorized_subsets) noexcept;
 
-	private:
-		struct point_information final // row
-		{
-			long long weight = 1;
-			size_t subsets_covering_in_solution = 0;
-		};
-
-		struct subset_information final // column
-		{
-			long long score = 0;
-			long long timestamp = 1;
-			bool canAddToSolution = true;
-		};
-
-		struct resolution_data final
-		{
-			random_engine& generator;
-			solution& best_solution;
-			solution current_solution;
-			dynamic_bitset<> uncovered_points; // RWLS name: L
-			std::vector<point_information> points_information;
-			std::vector<subset_information> subsets_information;
-			std::deque<size_t> tabu_subsets;
-
-			dynamic_bitset<> subsets_tmp;
-
-			explicit resolution_data(solution& solution, random_engine& generator) noexcept;
-		};
+		// Improve into report, reusing its buffers and those of data: no allocation once sized
+		// solution and points_weights_initial must not be part of report
+		[[gnu::hot]] void improve(const uscp::solution& solution,
+		                          const std::vector<long long>& points_weights_initial,
+		                          random_engine& generator,
+		                          position stopping_criterion,
+		                          resolution_data& data,
+		                          report& report) noexcept;
+
+		[[gnu::hot]] void restricted_improve(const uscp::solution& solution,
+		                                     const std::vector<long long>& points_weights_initial,
+		                                     random_engine& generator,
+		                                     position stopping_criterion,
+		                                     const dynamic_bitset<>& authorized_subsets,
+		                                     resolution_data& data,
+		                                     report& report) noexcept;
 
+	private:
 		template<bool restricted = false>
-		[[nodiscard, gnu::hot]] report improve_impl(
-		  const uscp::solution& solution,
-		  const std::vector<long long>& points_weights_initial,
-		  random_engine& generator,
-		  position stopping_criterion,
-		  const dynamic_bitset<>& authorized_subsets) noexcept;
+		[[gnu::hot]] void improve_impl(const uscp::solution& solution,
+		                               const std::vector<long long>& points_weights_initial,
+		                               random_engine& generator,
+		                               position stopping_criterion,
+		                               const dynamic_bitset<>& authorized_subsets,
+		                               resolution_data& data,
+		                               report& report) noexcept;
 
 		[[gnu::hot]] long long compute_subset_score(const resolution_data& data,
 		                                            size_t subset_number) noexcept;
@@ -164,10 +190,8 @@ namespace uscp::rwls
 		  resolution_data& data) noexcept;
 
 		const uscp::problem::instance& m_problem;
-		std::vector<std::vector<size_t>> m_subsets_points;
-		std::vector<std::vector<size_t>> m_subsets_covering_points;
-		bool m_initialized;
 		const std::shared_ptr<spdlog::logger> m_logger;
+		size_t m_target;
 	};
 
 	[[nodiscard, gnu::hot]] solution improve(const uscp::solution& solution_initial,
@@ -28,20 +28,22 @@ namespace uscp::wcrossover
 		keep& operator=(const keep& other) = delete;
 		keep& operator=(keep&& other) noexcept = delete;
 
-		std::vector<long long> apply1(const std::vector<long long>& a,
-		                              [[maybe_unused]] const std::vector<long long>& b,
-		                              [[maybe_unused]] random_engine& generator) const noexcept
+		void apply1(const std::vector<long long>& a,
+		            [[maybe_unused]] const std::vector<long long>& b,
+		            [[maybe_unused]] random_engine& generator,
+		            std::vector<long long>& weights) const noexcept
 		{
 			assert(a.size() == problem.points_number && b.size() == problem.points_number);
-			return a;
+			weights = a;
 		}
 
-		std::vector<long long> apply2([[maybe_unused]] const std::vector<long long>& a,
-		                              const std::vector<long long>& b,
-		                              [[maybe_unused]] random_engine& generator) const noexcept
+		void apply2([[maybe_unused]] const std::vector<long long>& a,
+		            const std::vector<long long>& b,
+		            [[maybe_unused]] random_engine& generator,
+		            std::vector<long long>& weights) const noexcept
 		{
 			assert(a.size() == problem.points_number && b.size() == problem.points_number);
-			return b;
+			weights = b;
 		}
 
 		[[nodiscard]] static std::string_view to_string() noexcept
@@ -0,0 +1,71 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#ifndef USCP_WCROSSOVER_KERNELS_HPP
+#define USCP_WCROSSOVER_KERNELS_HPP
+
+#include "common/utils/random.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace uscp::wcrossover
+{
+	// weights[i] = operation(a[i], b[i]) in the caller-owned weights, the buffers don't alias so
+	// the loop is vectorized without runtime checks
+	template<typename Operation>
+	void transform_weights(const std::vector<long long>& a,
+	                       const std::vector<long long>& b,
+	                       std::vector<long long>& weights,
+	                       Operation operation) noexcept
+	{
+		assert(a.size() == b.size());
+		assert(&weights != &a && &weights != &b);
+		weights.resize(a.size());
+		const size_t size = weights.size();
+		const long long* __restrict a_data = a.data();
+		const long long* __restrict b_data = b.data();
+		long long* __restrict weights_data = weights.data();
+		for(size_t i = 0; i < size; ++i)
+		{
+			weights_data[i] = operation(a_data[i], b_data[i]);
+		}
+	}
+
+	// weights[i] = a[i] or b[i] with the same probability, one generator draw gives the choices
+	// of word_size points, applied with branchless masks
+	inline void mix_weights(const std::vector<long long>& a,
+	                        const std::vector<long long>& b,
+	                        random_engine& generator,
+	                        std::vector<long long>& weights) noexcept
+	{
+		assert(a.size() == b.size());
+		assert(&weights != &a && &weights != &b);
+		constexpr size_t DRAW_BITS = random_engine::word_size;
+		static_assert(DRAW_BITS <= 64);
+		weights.resize(a.size());
+		const size_t size = weights.size();
+		const long long* __restrict a_data = a.data();
+		const long long* __restrict b_data = b.data();
+		long long* __restrict weights_data = weights.data();
+		for(size_t first = 0; first < size; first += DRAW_BITS)
+		{
+			const auto bits = static_cast<uint64_t>(generator());
+			const size_t last = std::min(first + DRAW_BITS, size);
+			for(size_t i = first; i < last; ++i)
+			{
+				const long long mask = -static_cast<long long>((bits >> (i - first)) & 1);
+				weights_data[i] = (a_data[i] & mask) | (b_data[i] & ~mask);
+			}
+		}
+	}
+} // namespace uscp::wcrossover
+
+#endif //USCP_WCROSSOVER_KERNELS_HPP
@@ -11,6 +11,7 @@
 #include "common/data/instance.hpp"
 #include "common/data/solution.hpp"
 #include "common/utils/random.hpp"
+#include "solver/algorithms/wcrossover/kernels.hpp"
 
 #include <dynamic_bitset.hpp>
 
@@ -29,33 +30,30 @@ namespace uscp::wcrossover
 		max& operator=(const max& other) = delete;
 		max& operator=(max&& other) noexcept = delete;
 
-		[[nodiscard]] std::vector<long long> apply(const std::vector<long long>& a,
-		                                           const std::vector<long long>& b) const noexcept
+		void apply(const std::vector<long long>& a,
+		           const std::vector<long long>& b,
+		           std::vector<long long>& weights) const noexcept
 		{
-			std::vector<long long> weights;
-			weights.reserve(problem.points_number);
-			std::transform(std::cbegin(a),
-			               std::cend(a),
-			               std::cbegin(b),
-			               std::back_inserter(weights),
-			               [](long long wa, long long wb) { return wa > wb ? wa : wb; });
-			return weights;
+			transform_weights(
+			  a, b, weights, [](long long wa, long long wb) { return wa > wb ? wa : wb; });
 		}
 
-		std::vector<long long> apply1(const std::vector<long long>& a,
-		                              const std::vector<long long>& b,
-		                              [[maybe_unused]] random_engine& generator) const noexcept
+		void apply1(const std::vector<long long>& a,
+		            const std::vector<long long>& b,
+		            [[maybe_unused]] random_engine& generator,
+		            std::vector<long long>& weights) const noexcept
 		{
 			assert(a.size() == problem.points_number && b.size() == problem.points_number);
-			return apply(a, b);
+			apply(a, b, weights);
 		}
 
-		std::vector<long long> apply2(const std::vector<long long>& a,
-		                              const std::vector<long long>& b,
-		                              [[maybe_unused]] random_engine& generator) const noexcept
+		void apply2(const std::vector<long long>& a,
+		            const std::vector<long long>& b,
+		            [[maybe_unused]] random_engine& generator,
+		            std::vector<long long>& weights) const noexcept
 		{
 			assert(a.size() == problem.points_number && b.size() == problem.points_number);
-			return apply(a, b);
+			apply(a, b, weights);
 		}
 
 		[[nodiscard]] static std::string_view to_string() noexcept
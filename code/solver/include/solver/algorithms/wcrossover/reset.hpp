@@ -21,7 +21,7 @@ namespace uscp::wcrossover
 	struct reset final
 	{
 		explicit reset(const uscp::problem::instance& problem_)
-		  : problem(problem_), weights(problem_.points_number, 1)
+		  : problem(problem_), initial_weights(problem_.points_number, 1)
 		{
 		}
 		reset(const reset&) = default;
@@ -29,18 +29,20 @@ namespace uscp::wcrossover
 		reset& operator=(const reset& other) = delete;
 		reset& operator=(reset&& other) noexcept = delete;
 
-		std::vector<long long> apply1([[maybe_unused]] const std::vector<long long>& a,
-		                              [[maybe_unused]] const std::vector<long long>& b,
-		                              [[maybe_unused]] random_engine& generator) const noexcept
+		void apply1([[maybe_unused]] const std::vector<long long>& a,
+		            [[maybe_unused]] const std::vector<long long>& b,
+		            [[maybe_unused]] random_engine& generator,
+		            std::vector<long long>& weights) const noexcept
 		{
-			return weights;
+			weights = initial_weights;
 		}
 
-		std::vector<long long> apply2([[maybe_unused]] const std::vector<long long>& a,
-		                              [[maybe_unused]] const std::vector<long long>& b,
-		                              [[maybe_unused]] random_engine& generator) const noexcept
+		void apply2([[maybe_unused]] const std::vector<long long>& a,
+		            [[maybe_unused]] const std::vector<long long>& b,
+		            [[maybe_unused]] random_engine& generator,
+		            std::vector<long long>& weights) const noexcept
 		{
-			return weights;
+			weights = initial_weights;
 		}
 
 		[[nodiscard]] static std::string_view to_string() noexcept
@@ -49,7 +51,7 @@ namespace uscp::wcrossover
 		}
 
 		const uscp::problem::instance& problem;
-		std::vector<long long> weights;
+		std::vector<long long> initial_weights;
 	};
 } // namespace uscp::wcrossover
 
@@ -29,24 +29,24 @@ namespace uscp::wcrossover
 		shuffle& operator=(const shuffle& other) = delete;
 		shuffle& operator=(shuffle&& other) noexcept = delete;
 
-		std::vector<long long> apply1(const std::vector<long long>& a,
-		                              [[maybe_unused]] const std::vector<long long>& b,
-		                              random_engine& generator) const noexcept
+		void apply1(const std::vector<long long>& a,
+		            [[maybe_unused]] const std::vector<long long>& b,
+		            random_engine& generator,
+		            std::vector<long long>& weights) const noexcept
 		{
 			assert(a.size() == problem.points_number && b.size() == problem.points_number);
-			std::vector<long long> weights = a;
+			weights = a;
 			std::shuffle(std::begin(weights), std::end(weights), generator);
-			return weights;
 		}
 
-		std::vector<long long> apply2([[maybe_unused]] const std::vector<long long>& a,
-		                              const std::vector<long long>& b,
-		                              random_engine& generator) const noexcept
+		void apply2([[maybe_unused]] const std::vector<long long>& a,
+		            const std::vector<long long>& b,
+		            random_engine& generator,
+		            std::vector<long long>& weights) const noexcept
 		{
 			assert(a.size() == problem.points_number && b.size() == problem.points_number);
-			std::vector<long long> weights = b;
+			weights = b;
 			std::shuffle(std::begin(weights), std::end(weights), generator);
-			return weights;
 		}
 
 		[[nodiscard]] static std::string_view to_string() noexcept
@@ -11,29 +11,58 @@
 #include "common/utils/random.hpp"
 #include "common/data/instance.hpp"
 
+#include <dynamic_bitset.hpp>
+
+#include <filesystem>
 #include <string_view>
 #include <cstddef>
+#include <cstdint>
+#include <vector>
 
 namespace uscp::problem
 {
 	static constexpr const std::string_view REDUCTIONS_CACHE_FOLDER = "./resources/reductions/";
 
+	// Random instance with each point covered by min_covering_subsets to max_covering_subsets
+	// distinct subsets, generated in parallel: the instance only depends on the seed and sizes
 	[[nodiscard]] instance generate(std::string_view name,
 	                                size_t points_number,
 	                                size_t subsets_number,
-	                                random_engine& generator,
+	                                uint64_t seed,
 	                                size_t min_covering_subsets,
 	                                size_t max_covering_subsets) noexcept;
 
+	// Balas and Ho parameters
 	[[nodiscard]] instance generate(std::string_view name,
 	                                size_t points_number,
 	                                size_t subsets_number,
-	                                random_engine& generator) noexcept;
+	                                uint64_t seed) noexcept;
+
+	// Same content as generate, written to a binary instance file without building the instance
+	bool generate_binary(const std::filesystem::path& path,
+	                     size_t points_number,
+	                     size_t subsets_number,
+	                     uint64_t seed,
+	                     size_t min_covering_subsets,
+	                     size_t max_covering_subsets,
+	                     bool override_file = false) noexcept;
 
 	[[nodiscard]] bool has_solution(const instance& instance) noexcept;
 
+	// Instance made of the authorized subsets and of the points they cover, the subset i of the
+	// extracted instance is the subset subsets_mapping[i] of the full instance.
+	// Sparse only: O(points + covering of the authorized subsets)
+	[[nodiscard]] instance extract(const instance& full_instance,
+	                               const dynamic_bitset<>& authorized_subsets,
+	                               std::vector<size_t>& subsets_mapping) noexcept;
+
 	[[nodiscard, gnu::hot]] instance reduce(const instance& full_instance) noexcept;
 
+	// Quiet inclusion-only reduction of an extracted subproblem, without the dense form: subsets
+	// covering a point alone are included, in O(points + covering number)
+	[[nodiscard, gnu::hot]] instance reduce_subproblem(
+	  const instance& subproblem_instance) noexcept;
+
 	[[nodiscard, gnu::hot]] instance reduce_cache(const instance& full_instance) noexcept;
 } // namespace uscp::problem
 
@@ -0,0 +1,34 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#ifndef USCP_INSTANCES_CACHE_HPP
+#define USCP_INSTANCES_CACHE_HPP
+
+#include "common/data/instances.hpp"
+
+#include <memory>
+#include <cstddef>
+
+// Process-wide cache of the read instances and of their reductions, keyed by content fingerprint.
+// Entries are evicted least recently used first once the cache exceeds its memory limit, the
+// returned instances stay valid as long as they are referenced.
+namespace uscp::problem::cache
+{
+	static constexpr size_t DEFAULT_MEMORY_LIMIT = size_t(1) << 30; // bytes
+
+	void set_memory_limit(size_t bytes) noexcept;
+
+	// nullptr if the instance cannot be read, see uscp::problem::read
+	[[nodiscard]] std::shared_ptr<const instance> read(const instance_info& info) noexcept;
+
+	// Reduced instance (see uscp::problem::reduce_cache), its parent instance is full_instance or
+	// a previously cached instance with the same content
+	[[nodiscard]] std::shared_ptr<const instance> reduce(
+	  const std::shared_ptr<const instance>& full_instance) noexcept;
+} // namespace uscp::problem::cache
+
+#endif //USCP_INSTANCES_CACHE_HPP
@@ -11,10 +11,19 @@
 #include "common/data/solution.hpp"
 #include "common/utils/logger.hpp"
 
+#include <cstddef>
+#include <vector>
+
 namespace uscp
 {
 	[[nodiscard]] solution expand(const solution& reduced_solution) noexcept;
 
+	// Select in full_solution the subsets of a solution of an instance extracted with
+	// subsets_mapping (see problem::extract)
+	void expand(const solution& extracted_solution,
+	            const std::vector<size_t>& subsets_mapping,
+	            solution& full_solution) noexcept;
+
 	template<typename T>
 	[[nodiscard]] std::vector<T> expand_points_info(const uscp::problem::instance& instance,
 	                                                const std::vector<T>& info,
@@ -30,7 +39,8 @@ namespace uscp
 		     + instance.reduction->reduction_applied.subsets_included.count())
 		    != instance.reduction->parent_instance->subsets_number)
 		   || ((instance.points_number
-		        + instance.reduction->reduction_applied.points_covered.count())
+		        + instance.reduction->reduction_applied.points_covered.count()
+		        + instance.reduction->reduction_applied.points_dominated.count())
 		       != instance.reduction->parent_instance->points_number))
 		{
 			LOGGER->error("Tried to expand solution of an invalid reduced instance");
@@ -47,33 +57,15 @@ namespace uscp
 
 		std::vector<T> expanded_info;
 		expanded_info.resize(instance.reduction->parent_instance->points_number, default_value);
-		size_t i_expanded = 0;
-		while(instance.reduction->reduction_applied.points_covered.test(i_expanded))
-		{
-			++i_expanded;
-		}
-		for(size_t i_reduced = 0; i_reduced < instance.points_number; ++i_reduced)
-		{
-			assert(i_expanded < instance.reduction->parent_instance->points_number);
+		const dynamic_bitset<> remaining_points =
+		  ~(instance.reduction->reduction_applied.points_covered
+		    | instance.reduction->reduction_applied.points_dominated);
+		size_t i_reduced = 0;
+		remaining_points.iterate_bits_on([&](size_t i_expanded) noexcept {
 			expanded_info[i_expanded] = info[i_reduced];
-
-			do
-			{
-				++i_expanded;
-				if(i_expanded >= instance.reduction->parent_instance->points_number)
-				{
-					break;
-				}
-			} while(instance.reduction->reduction_applied.points_covered.test(i_expanded));
-		}
-		assert(i_expanded == instance.reduction->parent_instance->points_number);
-		if(i_expanded != instance.reduction->parent_instance->points_number)
-		{
-			LOGGER->error("Solution points information expansion failed, only {}/{} points",
-			              i_expanded,
-			              instance.reduction->parent_instance->points_number);
-			abort();
-		}
+			++i_reduced;
+		});
+		assert(i_reduced == instance.points_number);
 
 		return expanded_info;
 	}
@@ -14,6 +14,7 @@
 
 #include <utility>
 #include <functional>
+#include <vector>
 
 #if defined(__GNUC__)
 #	define COND_LIKELY(expr) __builtin_expect(!!(expr), 1)
@@ -35,6 +36,46 @@
 
 namespace
 {
+	// number of points of each subset not covered by the solution
+	[[nodiscard]] std::vector<size_t> compute_gains(const uscp::solution& solution) noexcept
+	{
+		const uscp::problem::instance& problem = solution.problem;
+		std::vector<size_t> gains(problem.subsets_number, 0);
+		for(size_t i_subset = 0; i_subset < problem.subsets_number; ++i_subset)
+		{
+			for(uscp::problem::sparse_rows::index_type point:
+			    problem.subsets_points_csr[i_subset])
+			{
+				if(!solution.covered_points.test(point))
+				{
+					++gains[i_subset];
+				}
+			}
+		}
+		return gains;
+	}
+
+	// select the subset and update the gains of the subsets covering the newly covered points
+	void select_subset(uscp::solution& solution, size_t subset, std::vector<size_t>& gains) noexcept
+	{
+		const uscp::problem::instance& problem = solution.problem;
+		solution.selected_subsets.set(subset);
+		for(uscp::problem::sparse_rows::index_type point: problem.subsets_points_csr[subset])
+		{
+			if(solution.covered_points.test(point))
+			{
+				continue;
+			}
+			solution.covered_points.set(point);
+			for(uscp::problem::sparse_rows::index_type covering_subset:
+			    problem.points_subsets_csr[point])
+			{
+				assert(gains[covering_subset] > 0);
+				--gains[covering_subset];
+			}
+		}
+	}
+
 	template<typename is_greater_t, bool restricted>
 	[[nodiscard, gnu::hot]] uscp::greedy::report solve_report_impl(
 	  const uscp::problem::instance& problem,
@@ -50,14 +91,13 @@ namespace
 		const timer timer;
 
 		uscp::greedy::report report(problem);
+		std::vector<size_t> gains = compute_gains(report.solution_final);
+		size_t covered_points_number = report.solution_final.covered_points.count();
 		while(!report.solution_final.cover_all_points)
 		{
 			size_t max_subset_number =
 			  report.solution_final.selected_subsets.size(); //invalid initial value
-			dynamic_bitset<> covered_points_with_max_subset(problem.points_number);
-			size_t covered_points_number_with_max_subset =
-			  report.solution_final.covered_points.count();
-			dynamic_bitset<> new_covered_points;
+			size_t max_gain = 0;
 			for(size_t i = 0; i < problem.subsets_number; ++i)
 			{
 				if constexpr(restricted)
@@ -73,14 +113,10 @@ namespace
 					continue;
 				}
 
-				new_covered_points = report.solution_final.covered_points;
-				new_covered_points |= problem.subsets_points[i];
-				const size_t new_covered_points_number = new_covered_points.count();
-				if(is_greater(new_covered_points_number, covered_points_number_with_max_subset))
+				if(is_greater(gains[i], max_gain))
 				{
 					max_subset_number = i;
-					covered_points_with_max_subset = new_covered_points;
-					covered_points_number_with_max_subset = new_covered_points_number;
+					max_gain = gains[i];
 				}
 			}
 
@@ -92,9 +128,9 @@ namespace
 			}
 
 			// update solution (faster)
-			report.solution_final.selected_subsets[max_subset_number].set();
-			report.solution_final.covered_points = covered_points_with_max_subset;
-			report.solution_final.cover_all_points = report.solution_final.covered_points.all();
+			select_subset(report.solution_final, max_subset_number, gains);
+			covered_points_number += max_gain;
+			report.solution_final.cover_all_points = covered_points_number == problem.points_number;
 
 			// update solution (slower)
 			//solution.compute_cover();
@@ -130,14 +166,13 @@ namespace
 		uscp::greedy::report report(problem);
 		size_t equal_counter = 0;
 		std::uniform_real_distribution<> dist(0.0, 1.0);
+		std::vector<size_t> gains = compute_gains(report.solution_final);
+		size_t covered_points_number = report.solution_final.covered_points.count();
 		while(!report.solution_final.cover_all_points)
 		{
 			size_t max_subset_number =
 			  report.solution_final.selected_subsets.size(); //invalid initial value
-			dynamic_bitset<> covered_points_with_max_subset(problem.points_number);
-			size_t covered_points_number_with_max_subset =
-			  report.solution_final.covered_points.count();
-			dynamic_bitset<> new_covered_points;
+			size_t max_gain = 0;
 			for(size_t i = 0; i < problem.subsets_number; ++i)
 			{
 				if constexpr(restricted)
@@ -153,23 +188,18 @@ namespace
 					continue;
 				}
 
-				new_covered_points = report.solution_final.covered_points;
-				new_covered_points |= problem.subsets_points[i];
-				const size_t new_covered_points_number = new_covered_points.count();
-				if(new_covered_points_number > covered_points_number_with_max_subset)
+				if(gains[i] > max_gain)
 				{
 					max_subset_number = i;
-					covered_points_with_max_subset = new_covered_points;
-					covered_points_number_with_max_subset = new_covered_points_number;
+					max_gain = gains[i];
 					equal_counter = 1;
 				}
-				else if(new_covered_points_number == covered_points_number_with_max_subset)
+				else if(gains[i] == max_gain)
 				{
 					++equal_counter;
 					if(dist(generator) < (1.0 / equal_counter))
 					{
 						max_subset_number = i;
-						covered_points_with_max_subset = new_covered_points;
 					}
 				}
 			}
@@ -182,9 +212,9 @@ namespace
 			}
 
 			// update solution (faster)
-			report.solution_final.selected_subsets[max_subset_number].set();
-			report.solution_final.covered_points = covered_points_with_max_subset;
-			report.solution_final.cover_all_points = report.solution_final.covered_points.all();
+			select_subset(report.solution_final, max_subset_number, gains);
+			covered_points_number += max_gain;
+			report.solution_final.cover_all_points = covered_points_number == problem.points_number;
 
 			// update solution (slower)
 			//solution.compute_cover();
@@ -35,6 +35,14 @@ uscp::memetic::config_serial uscp::memetic::config::serialize() const noexcept
 	config_serial serial;
 	serial.stopping_criterion = stopping_criterion.serialize();
 	serial.rwls_stopping_criterion = rwls_stopping_criterion.serialize();
+	serial.prune_redundant = prune_redundant;
+	serial.prune_order = uscp::redundancy::to_string(prune_order);
+	serial.population_size = population_size;
+	serial.islands = islands;
+	serial.migration_interval = migration_interval;
+	serial.steady_state = steady_state;
+	serial.outcomes_table_size = outcomes_table_size;
+	serial.target = target;
 	return serial;
 }
 
@@ -50,6 +58,38 @@ bool uscp::memetic::config::load(const uscp::memetic::config_serial& serial) noe
 		LOGGER->warn("Failed to load rwls stopping criterion");
 		return false;
 	}
+	prune_redundant = serial.prune_redundant;
+	if(!uscp::redundancy::from_string(serial.prune_order, prune_order))
+	{
+		LOGGER->warn("Invalid prune order: {}", serial.prune_order);
+		return false;
+	}
+	population_size = serial.population_size;
+	islands = serial.islands;
+	migration_interval = serial.migration_interval;
+	steady_state = serial.steady_state;
+	outcomes_table_size = serial.outcomes_table_size;
+	target = serial.target;
+	return true;
+}
+
+uscp::memetic::operators_usage_serial uscp::memetic::operators_usage::serialize() const noexcept
+{
+	operators_usage_serial serial;
+	serial.crossover_operator = crossover_operator;
+	serial.wcrossover_operator = wcrossover_operator;
+	serial.children = children;
+	serial.mean_reward = mean_reward;
+	return serial;
+}
+
+bool uscp::memetic::operators_usage::load(
+  const uscp::memetic::operators_usage_serial& serial) noexcept
+{
+	crossover_operator = serial.crossover_operator;
+	wcrossover_operator = serial.wcrossover_operator;
+	children = serial.children;
+	mean_reward = serial.mean_reward;
 	return true;
 }
 
@@ -68,6 +108,12 @@ uscp::memetic::report_serial uscp::memetic::report::serialize() const noexcept
 	serial.solve_config = solve_config.serialize();
 	serial.crossover_operator = crossover_operator;
 	serial.wcrossover_operator = wcrossover_operator;
+	serial.target_reached = target_reached;
+	serial.operators_selection.reserve(operators_selection.size());
+	for(const operators_usage& usage: operators_selection)
+	{
+		serial.operators_selection.push_back(usage.serialize());
+	}
 	return serial;
 }
 
@@ -96,6 +142,16 @@ bool uscp::memetic::report::load(const uscp::memetic::report_serial& serial) noe
 	}
 	crossover_operator = serial.crossover_operator;
 	wcrossover_operator = serial.wcrossover_operator;
+	target_reached = serial.target_reached;
+	operators_selection.resize(serial.operators_selection.size());
+	for(size_t i = 0; i < operators_selection.size(); ++i)
+	{
+		if(!operators_selection[i].load(serial.operators_selection[i]))
+		{
+			LOGGER->warn("Failed to load operators usage");
+			return false;
+		}
+	}
 	return true;
 }
 
@@ -115,5 +171,7 @@ uscp::memetic::report uscp::memetic::expand(const uscp::memetic::report& reduced
 	expanded_report.solve_config = reduced_report.solve_config;
 	expanded_report.crossover_operator = reduced_report.crossover_operator;
 	expanded_report.wcrossover_operator = reduced_report.wcrossover_operator;
+	expanded_report.target_reached = reduced_report.target_reached;
+	expanded_report.operators_selection = reduced_report.operators_selection;
 	return expanded_report;
 }
@@ -0,0 +1,84 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#include "solver/algorithms/operators_selector.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+uscp::memetic::operators_selector::operators_selector(size_t arms) noexcept
+  : m_arms(std::max(arms, size_t(1))), m_uses(0)
+{
+}
+
+size_t uscp::memetic::operators_selector::select() noexcept
+{
+	size_t selected = 0;
+	const auto unused =
+	  std::find_if(std::cbegin(m_arms), std::cend(m_arms), [](const arm_state& arm) noexcept {
+		  return arm.uses == 0;
+	  });
+	if(unused != std::cend(m_arms))
+	{
+		selected = static_cast<size_t>(std::distance(std::cbegin(m_arms), unused));
+	}
+	else
+	{
+		// rewards are unbounded: the exploration term is scaled by the best mean reward
+		double best_mean = 0;
+		for(size_t i = 0; i < m_arms.size(); ++i)
+		{
+			best_mean = std::max(best_mean, mean_reward(i));
+		}
+		const double scale = best_mean > 0 ? best_mean : 1;
+		const double log_uses = std::log(static_cast<double>(m_uses));
+		double best_bound = -1;
+		for(size_t i = 0; i < m_arms.size(); ++i)
+		{
+			const double bound =
+			  mean_reward(i)
+			  + scale * std::sqrt(2 * log_uses / static_cast<double>(m_arms[i].uses));
+			if(bound > best_bound)
+			{
+				best_bound = bound;
+				selected = i;
+			}
+		}
+	}
+	++m_arms[selected].uses;
+	++m_uses;
+	return selected;
+}
+
+void uscp::memetic::operators_selector::update(size_t arm, double reward) noexcept
+{
+	assert(arm < m_arms.size());
+	assert(m_arms[arm].uses > 0);
+	m_arms[arm].rewards += reward;
+}
+
+size_t uscp::memetic::operators_selector::arms() const noexcept
+{
+	return m_arms.size();
+}
+
+size_t uscp::memetic::operators_selector::uses(size_t arm) const noexcept
+{
+	assert(arm < m_arms.size());
+	return m_arms[arm].uses;
+}
+
+double uscp::memetic::operators_selector::mean_reward(size_t arm) const noexcept
+{
+	assert(arm < m_arms.size());
+	if(m_arms[arm].uses == 0)
+	{
+		return 0;
+	}
+	return m_arms[arm].rewards / static_cast<double>(m_arms[arm].uses);
+}
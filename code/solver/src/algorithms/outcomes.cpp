@@ -0,0 +1,63 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#include "solver/algorithms/outcomes.hpp"
+
+#include <cassert>
+
+uscp::memetic::outcomes::outcome::outcome(const problem::instance& problem) noexcept
+  : solution_final(problem), points_weights_final()
+{
+}
+
+uscp::memetic::outcomes::entry::entry(const problem::instance& problem) noexcept
+  : selected_subsets(), result(problem)
+{
+}
+
+uscp::memetic::outcomes::outcomes(const problem::instance& problem, size_t size) noexcept
+  : m_entries(size, entry(problem))
+{
+}
+
+const uscp::memetic::outcomes::outcome* uscp::memetic::outcomes::find(
+  uint64_t hash,
+  const uscp::solution& solution) const noexcept
+{
+	if(m_entries.empty())
+	{
+		return nullptr;
+	}
+	const entry& slot = m_entries[hash % m_entries.size()];
+	if(!slot.used || slot.hash != hash || slot.selected_subsets != solution.selected_subsets)
+	{
+		return nullptr;
+	}
+	return &slot.result;
+}
+
+void uscp::memetic::outcomes::insert(uint64_t hash,
+                                     const uscp::solution& solution,
+                                     const uscp::rwls::report& report) noexcept
+{
+	if(m_entries.empty())
+	{
+		return;
+	}
+	assert(solution_hash(solution) == hash);
+	entry& slot = m_entries[hash % m_entries.size()];
+	slot.used = true;
+	slot.hash = hash;
+	slot.selected_subsets = solution.selected_subsets;
+	slot.result.solution_final = report.solution_final;
+	slot.result.points_weights_final = report.points_weights_final;
+}
+
+bool uscp::memetic::outcomes::enabled() const noexcept
+{
+	return !m_entries.empty();
+}
@@ -28,7 +28,7 @@ uscp::solution uscp::random::solve(random_engine& generator,
 			selected_subset = dist(generator);
 		}
 		solution.selected_subsets.set(selected_subset);
-		solution.covered_points |= problem.subsets_points[selected_subset];
+		problem::add_subset_points(problem, selected_subset, solution.covered_points);
 	}
 	solution.cover_all_points = true;
 
@@ -61,7 +61,7 @@ uscp::solution uscp::random::restricted_solve(uscp::random_engine& generator,
 			selected_subset = dist(generator);
 		}
 		solution.selected_subsets.set(selected_subset);
-		solution.covered_points |= problem.subsets_points[selected_subset];
+		problem::add_subset_points(problem, selected_subset, solution.covered_points);
 	}
 	solution.cover_all_points = true;
 
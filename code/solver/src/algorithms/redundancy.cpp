@@ -0,0 +1,140 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#include "solver/algorithms/redundancy.hpp"
+#include "common/utils/timer.hpp"
+
+#include <dynamic_bitset.hpp>
+
+#include <vector>
+#include <algorithm>
+#include <utility>
+
+namespace
+{
+	template<bool random>
+	[[gnu::hot]] size_t prune_impl([[maybe_unused]] uscp::random_engine* generator,
+	                               uscp::solution& solution,
+	                               std::shared_ptr<spdlog::logger> logger) noexcept
+	{
+		const uscp::problem::instance& problem = solution.problem;
+		SPDLOG_LOGGER_DEBUG(logger, "({}) Start pruning redundant subsets", problem.name);
+		const timer timer;
+
+		// subsets covering each point
+		std::vector<size_t> points_cover(problem.points_number, 0);
+		std::vector<std::pair<size_t, size_t>> subsets; // (subset, points number)
+		subsets.reserve(solution.selected_subsets.count());
+		solution.selected_subsets.iterate_bits_on([&](size_t subset) noexcept {
+			const uscp::problem::sparse_rows::row_view subset_points =
+			  problem.subsets_points_csr[subset];
+			for(uscp::problem::sparse_rows::index_type point: subset_points)
+			{
+				++points_cover[point];
+			}
+			subsets.emplace_back(subset, subset_points.size());
+		});
+
+		if constexpr(random)
+		{
+			std::shuffle(std::begin(subsets), std::end(subsets), *generator);
+		}
+		else
+		{
+			std::stable_sort(std::begin(subsets),
+			                 std::end(subsets),
+			                 [](const std::pair<size_t, size_t>& lhs,
+			                    const std::pair<size_t, size_t>& rhs) noexcept {
+				                 return lhs.second > rhs.second;
+			                 });
+		}
+
+		size_t removed_subsets = 0;
+		for(const auto& [subset, points_number]: subsets)
+		{
+			const uscp::problem::sparse_rows::row_view subset_points =
+			  problem.subsets_points_csr[subset];
+			bool redundant = true;
+			for(uscp::problem::sparse_rows::index_type point: subset_points)
+			{
+				if(points_cover[point] < 2)
+				{
+					redundant = false;
+					break;
+				}
+			}
+			if(!redundant)
+			{
+				continue;
+			}
+
+			for(uscp::problem::sparse_rows::index_type point: subset_points)
+			{
+				--points_cover[point];
+			}
+			solution.selected_subsets.reset(subset);
+			++removed_subsets;
+		}
+
+		SPDLOG_LOGGER_DEBUG(logger,
+		                    "({}) Pruned {} redundant subsets in {}s",
+		                    problem.name,
+		                    removed_subsets,
+		                    timer.elapsed());
+		return removed_subsets;
+	}
+} // namespace
+
+size_t uscp::redundancy::prune(uscp::solution& solution,
+                               std::shared_ptr<spdlog::logger> logger) noexcept
+{
+	return prune_impl<false>(nullptr, solution, std::move(logger));
+}
+
+size_t uscp::redundancy::random_prune(uscp::random_engine& generator,
+                                      uscp::solution& solution,
+                                      std::shared_ptr<spdlog::logger> logger) noexcept
+{
+	return prune_impl<true>(&generator, solution, std::move(logger));
+}
+
+size_t uscp::redundancy::prune(uscp::redundancy::order order,
+                               uscp::random_engine& generator,
+                               uscp::solution& solution,
+                               std::shared_ptr<spdlog::logger> logger) noexcept
+{
+	if(order == order::random)
+	{
+		return random_prune(generator, solution, std::move(logger));
+	}
+	return prune(solution, std::move(logger));
+}
+
+std::string_view uscp::redundancy::to_string(uscp::redundancy::order order) noexcept
+{
+	switch(order)
+	{
+		case order::largest:
+			return "largest";
+		case order::random:
+			return "random";
+	}
+	return "unknown";
+}
+
+bool uscp::redundancy::from_string(std::string_view name, uscp::redundancy::order& order) noexcept
+{
+	for(const uscp::redundancy::order candidate: {order::largest, order::random})
+	{
+		if(name == to_string(candidate))
+		{
+			order = candidate;
+			return true;
+		}
+	}
+	return false;
+}
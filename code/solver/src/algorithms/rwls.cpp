@@ -40,14 +40,16 @@
 #endif
 
 template<bool restricted>
-uscp::rwls::report uscp::rwls::rwls::improve_impl(
-  const uscp::solution& solution,
-  const std::vector<long long>& points_weights_initial,
-  uscp::random_engine& generator,
-  uscp::rwls::position stopping_criterion,
-  [[maybe_unused]] const dynamic_bitset<>& authorized_subsets) noexcept
+void uscp::rwls::rwls::improve_impl(const uscp::solution& solution,
+                                    const std::vector<long long>& points_weights_initial,
+                                    uscp::random_engine& generator,
+                                    uscp::rwls::position stopping_criterion,
+                                    [[maybe_unused]] const dynamic_bitset<>& authorized_subsets,
+                                    uscp::rwls::rwls::resolution_data& data,
+                                    uscp::rwls::report& report) noexcept
 {
 	assert(points_weights_initial.size() == m_problem.points_number);
+	assert(&solution != &report.solution_initial && &solution != &report.solution_final);
 #ifndef NDEBUG
 	if constexpr(restricted)
 	{
@@ -58,26 +60,26 @@ uscp::rwls::report uscp::rwls::rwls::improve_impl(
 	}
 #endif
 
-	if(!m_initialized)
-	{
-		initialize();
-	}
-
 	m_logger->info("({}) Start optimising by RWLS solution with {} subsets",
 	               solution.problem.name,
 	               solution.selected_subsets.count());
 
-	report report(m_problem);
 	report.solution_initial = solution;
 	report.solution_final = solution;
 	report.found_at = {0, 0};
 	report.ended_at = {0, 0};
 	report.stopping_criterion = stopping_criterion;
+	report.target = m_target;
+	report.target_reached = false;
 	report.points_weights_initial = points_weights_initial;
+	report.points_weights_final.resize(m_problem.points_number);
 
 	timer timer;
-	resolution_data data(report.solution_final, generator);
+	data.generator = &generator;
+	data.best_solution = &report.solution_final;
+	data.current_solution = solution;
 	init(data, points_weights_initial);
+	report.solution_final_hash = data.current_solution_hash;
 	SPDLOG_LOGGER_DEBUG(m_logger, "({}) RWLS inited in {}s", m_problem.name, timer.elapsed());
 
 	timer.reset();
@@ -88,7 +90,8 @@ uscp::rwls::report uscp::rwls::rwls::improve_impl(
 		{
 			do
 			{
-				data.best_solution = data.current_solution;
+				*data.best_solution = data.current_solution;
+				report.solution_final_hash = data.current_solution_hash;
 				report.found_at.steps = step;
 				report.found_at.time = timer.elapsed();
 				for(size_t i = 0; i < m_problem.points_number; ++i)
@@ -98,7 +101,7 @@ uscp::rwls::report uscp::rwls::rwls::improve_impl(
 				SPDLOG_LOGGER_DEBUG(m_logger,
 				                    "({}) RWLS new best solution with {} subsets at step {} in {}s",
 				                    m_problem.name,
-				                    data.best_solution.selected_subsets.count(),
+				                    data.best_solution->selected_subsets.count(),
 				                    step,
 				                    timer.elapsed());
 
@@ -113,7 +116,7 @@ uscp::rwls::report uscp::rwls::rwls::improve_impl(
 						report.ended_at.time = timer.elapsed();
 						m_logger->warn("({}) There is no authorized subset to remove: RWLS stopped",
 						               m_problem.name);
-						return report;
+						return;
 					}
 					selected_subset = subset.value();
 				}
@@ -124,13 +127,24 @@ uscp::rwls::report uscp::rwls::rwls::improve_impl(
 				remove_subset(data, selected_subset);
 			} while(data.uncovered_points.none());
 
-			data.best_solution.compute_cover();
-			assert(data.best_solution.cover_all_points);
-			if(!data.best_solution.cover_all_points)
+			data.best_solution->compute_cover();
+			assert(data.best_solution->cover_all_points);
+			if(!data.best_solution->cover_all_points)
 			{
 				LOGGER->error("RWLS new best solution doesn't cover all points");
 				abort();
 			}
+
+			if(m_target != 0 && data.best_solution->selected_subsets.count() <= m_target)
+			{
+				m_logger->info("({}) RWLS reached the target of {} subsets at step {} in {}s",
+				               m_problem.name,
+				               m_target,
+				               step,
+				               timer.elapsed());
+				report.target_reached = true;
+				break;
+			}
 		}
 
 		// remove subset
@@ -145,7 +159,7 @@ uscp::rwls::report uscp::rwls::rwls::improve_impl(
 				report.ended_at.time = timer.elapsed();
 				m_logger->warn("({}) There is no authorized subset to remove: RWLS stopped",
 				               m_problem.name);
-				return report;
+				return;
 			}
 			subset_to_remove = subset.value();
 		}
@@ -169,7 +183,7 @@ uscp::rwls::report uscp::rwls::rwls::improve_impl(
 				report.ended_at.time = timer.elapsed();
 				m_logger->warn("({}) There is no authorized subset to add: RWLS stopped",
 				               m_problem.name);
-				return report;
+				return;
 			}
 			subset_to_add = subset.value();
 		}
@@ -191,7 +205,8 @@ uscp::rwls::report uscp::rwls::rwls::improve_impl(
 
 			// update subsets score depending on this point weight
 			// subset that can cover the point if added to solution
-			for(size_t subset_covering_point: m_subsets_covering_points[uncovered_points_bit_on])
+			for(size_t subset_covering_point:
+			    m_problem.points_subsets_csr[uncovered_points_bit_on])
 			{
 				++data.subsets_information[subset_covering_point].score;
 			}
@@ -210,11 +225,9 @@ uscp::rwls::report uscp::rwls::rwls::improve_impl(
 
 	m_logger->info("({}) Optimised by RWLS solution to {} subsets in {} steps {}s",
 	               m_problem.name,
-	               data.best_solution.selected_subsets.count(),
+	               data.best_solution->selected_subsets.count(),
 	               step,
 	               timer.elapsed());
-
-	return report;
 }
 
 uscp::rwls::position& uscp::rwls::position::operator+=(const uscp::rwls::position& other) noexcept
@@ -275,6 +288,8 @@ uscp::rwls::report_serial uscp::rwls::report::serialize() const noexcept
 	serial.found_at = found_at.serialize();
 	serial.ended_at = ended_at.serialize();
 	serial.stopping_criterion = stopping_criterion.serialize();
+	serial.target = target;
+	serial.target_reached = target_reached;
 	return serial;
 }
 
@@ -291,6 +306,7 @@ bool uscp::rwls::report::load(const uscp::rwls::report_serial& serial) noexcept
 		LOGGER->warn("Failed to load final solution");
 		return false;
 	}
+	solution_final_hash = solution_hash(solution_final);
 	points_weights_final = serial.points_weights_final;
 	if(!found_at.load(serial.found_at))
 	{
@@ -307,33 +323,21 @@ bool uscp::rwls::report::load(const uscp::rwls::report_serial& serial) noexcept
 		LOGGER->warn("Failed to load stopping criterion");
 		return false;
 	}
+	target = serial.target;
+	target_reached = serial.target_reached;
 
 	return true;
 }
 
 uscp::rwls::rwls::rwls(const problem::instance& problem,
                        std::shared_ptr<spdlog::logger> logger) noexcept
-  : m_problem(problem)
-  , m_subsets_points()
-  , m_subsets_covering_points()
-  , m_initialized(false)
-  , m_logger(std::move(logger))
+  : m_problem(problem), m_logger(std::move(logger)), m_target(0)
 {
-	m_subsets_points.resize(m_problem.subsets_number);
-	m_subsets_covering_points.resize(m_problem.points_number);
 }
 
-void uscp::rwls::rwls::initialize() noexcept
+void uscp::rwls::rwls::set_target(size_t target) noexcept
 {
-	for(size_t i = 0; i < m_problem.subsets_number; ++i)
-	{
-		m_problem.subsets_points[i].iterate_bits_on([&](size_t bit_on) noexcept {
-			m_subsets_points[i].push_back(bit_on);
-			m_subsets_covering_points[bit_on].push_back(i);
-		});
-	}
-
-	m_initialized = true;
+	m_target = target;
 }
 
 uscp::rwls::report uscp::rwls::rwls::improve(const uscp::solution& solution,
@@ -349,8 +353,10 @@ uscp::rwls::report uscp::rwls::rwls::improve(const uscp::solution& solution,
                                              uscp::random_engine& generator,
                                              uscp::rwls::position stopping_criterion) noexcept
 {
-	return improve_impl<false>(
-	  solution, points_weights_initial, generator, stopping_criterion, dynamic_bitset<>{});
+	resolution_data data(m_problem);
+	report report(m_problem);
+	improve(solution, points_weights_initial, generator, stopping_criterion, data, report);
+	return report;
 }
 
 uscp::rwls::report uscp::rwls::rwls::restricted_improve(
@@ -371,23 +377,61 @@ uscp::rwls::report uscp::rwls::rwls::restricted_improve(
   uscp::rwls::position stopping_criterion,
   const dynamic_bitset<>& authorized_subsets) noexcept
 {
-	return improve_impl<true>(
-	  solution, points_weights_initial, generator, stopping_criterion, authorized_subsets);
+	resolution_data data(m_problem);
+	report report(m_problem);
+	restricted_improve(solution,
+	                   points_weights_initial,
+	                   generator,
+	                   stopping_criterion,
+	                   authorized_subsets,
+	                   data,
+	                   report);
+	return report;
 }
 
-uscp::rwls::rwls::resolution_data::resolution_data(uscp::solution& solution,
-                                                   uscp::random_engine& generator_) noexcept
-  : generator(generator_)
-  , best_solution(solution)
-  , current_solution(solution)
-  , uncovered_points(solution.problem.points_number)
+void uscp::rwls::rwls::improve(const uscp::solution& solution,
+                               const std::vector<long long>& points_weights_initial,
+                               uscp::random_engine& generator,
+                               uscp::rwls::position stopping_criterion,
+                               uscp::rwls::rwls::resolution_data& data,
+                               uscp::rwls::report& report) noexcept
+{
+	improve_impl<false>(solution,
+	                    points_weights_initial,
+	                    generator,
+	                    stopping_criterion,
+	                    dynamic_bitset<>{},
+	                    data,
+	                    report);
+}
+
+void uscp::rwls::rwls::restricted_improve(const uscp::solution& solution,
+                                          const std::vector<long long>& points_weights_initial,
+                                          uscp::random_engine& generator,
+                                          uscp::rwls::position stopping_criterion,
+                                          const dynamic_bitset<>& authorized_subsets,
+                                          uscp::rwls::rwls::resolution_data& data,
+                                          uscp::rwls::report& report) noexcept
+{
+	improve_impl<true>(solution,
+	                   points_weights_initial,
+	                   generator,
+	                   stopping_criterion,
+	                   authorized_subsets,
+	                   data,
+	                   report);
+}
+
+uscp::rwls::rwls::resolution_data::resolution_data(const problem::instance& problem) noexcept
+  : current_solution(problem)
+  , uncovered_points(problem.points_number)
   , points_information()
   , subsets_information()
   , tabu_subsets()
-  , subsets_tmp(solution.problem.subsets_number)
+  , subsets_tmp(problem.subsets_number)
 {
-	points_information.resize(solution.problem.points_number);
-	subsets_information.resize(solution.problem.subsets_number);
+	points_information.resize(problem.points_number);
+	subsets_information.resize(problem.subsets_number);
 }
 
 long long uscp::rwls::rwls::compute_subset_score(const uscp::rwls::rwls::resolution_data& data,
@@ -399,19 +443,21 @@ long long uscp::rwls::rwls::compute_subset_score(const uscp::rwls::rwls::resolut
 	if(data.current_solution.selected_subsets[subset_number])
 	{
 		// if in solution, gain score for points covered only by the subset
-		m_problem.subsets_points[subset_number].iterate_bits_on([&](size_t bit_on) noexcept {
+		for(size_t bit_on: m_problem.subsets_points_csr[subset_number])
+		{
 			if(data.points_information[bit_on].subsets_covering_in_solution == 1)
 			{
 				assert(!data.uncovered_points[bit_on]);
 				subset_score -= data.points_information[bit_on].weight;
 			}
-		});
+		}
 		assert(subset_score <= 0);
 	}
 	else
 	{
 		// if out of solution, gain score for uncovered points it can cover
-		m_problem.subsets_points[subset_number].iterate_bits_on([&](size_t bit_on) noexcept {
+		for(size_t bit_on: m_problem.subsets_points_csr[subset_number])
+		{
 			if(data.points_information[bit_on].subsets_covering_in_solution == 0)
 			{
 				assert(data.uncovered_points[bit_on]);
@@ -421,7 +467,7 @@ long long uscp::rwls::rwls::compute_subset_score(const uscp::rwls::rwls::resolut
 			{
 				assert(!data.uncovered_points[bit_on]);
 			}
-		});
+		}
 		assert(subset_score >= 0);
 	}
 
@@ -433,6 +479,11 @@ void uscp::rwls::rwls::init(uscp::rwls::rwls::resolution_data& data,
 {
 	assert(points_weights_initial.size() == m_problem.points_number);
 
+	// the initial solution covers all points, reset buffers of a previous resolution
+	data.uncovered_points.reset();
+	data.tabu_subsets.clear();
+	data.current_solution_hash = solution_hash(data.current_solution);
+
 	// points information
 	dynamic_bitset<> tmp;
 #pragma omp parallel for default(none) shared(data, points_weights_initial) private(tmp)
@@ -443,7 +494,7 @@ void uscp::rwls::rwls::init(uscp::rwls::rwls::resolution_data& data,
 		const size_t i = static_cast<size_t>(i_int);
 		data.points_information[i].weight = points_weights_initial[i];
 		data.points_information[i].subsets_covering_in_solution = 0;
-		for(size_t subset_covering_point: m_subsets_covering_points[i])
+		for(size_t subset_covering_point: m_problem.points_subsets_csr[i])
 		{
 			if(data.current_solution.selected_subsets.test(subset_covering_point))
 			{
@@ -460,6 +511,8 @@ void uscp::rwls::rwls::init(uscp::rwls::rwls::resolution_data& data,
 	{
 		const size_t i = static_cast<size_t>(i_int);
 		data.subsets_information[i].score = compute_subset_score(data, i);
+		data.subsets_information[i].timestamp = 1;
+		data.subsets_information[i].canAddToSolution = true;
 		assert(data.current_solution.selected_subsets[i] ? data.subsets_information[i].score <= 0
 		                                                 : data.subsets_information[i].score >= 0);
 	}
@@ -474,20 +527,21 @@ void uscp::rwls::rwls::add_subset(uscp::rwls::rwls::resolution_data& data,
 
 	// add subset to solution
 	data.current_solution.selected_subsets.set(subset_number);
-	data.uncovered_points -= m_problem.subsets_points[subset_number];
+	data.current_solution_hash ^= subset_hash(subset_number);
 
 	// compute new score
 	const long long new_score = -data.subsets_information[subset_number].score;
 
 	// update subsets and points information
-	for(size_t subset_point: m_subsets_points[subset_number])
+	for(size_t subset_point: m_problem.subsets_points_csr[subset_number])
 	{
 		++data.points_information[subset_point].subsets_covering_in_solution;
 		if(data.points_information[subset_point].subsets_covering_in_solution == 1)
 		{
 			// point newly covered
+			data.uncovered_points.reset(subset_point);
 			const long long point_weight = data.points_information[subset_point].weight;
-			for(size_t neighbor: m_subsets_covering_points[subset_point])
+			for(size_t neighbor: m_problem.points_subsets_csr[subset_point])
 			{
 				data.subsets_information[neighbor].canAddToSolution = true;
 
@@ -499,7 +553,7 @@ void uscp::rwls::rwls::add_subset(uscp::rwls::rwls::resolution_data& data,
 		{
 			// point now covered twice
 			const long long point_weight = data.points_information[subset_point].weight;
-			for(size_t neighbor: m_subsets_covering_points[subset_point])
+			for(size_t neighbor: m_problem.points_subsets_csr[subset_point])
 			{
 				data.subsets_information[neighbor].canAddToSolution = true;
 
@@ -536,12 +590,13 @@ void uscp::rwls::rwls::remove_subset(uscp::rwls::rwls::resolution_data& data,
 
 	// remove subset from solution
 	data.current_solution.selected_subsets.reset(subset_number);
+	data.current_solution_hash ^= subset_hash(subset_number);
 
 	// compute new score
 	const long long new_score = -data.subsets_information[subset_number].score;
 
 	// update subsets and points information
-	for(size_t subset_point: m_subsets_points[subset_number])
+	for(size_t subset_point: m_problem.subsets_points_csr[subset_number])
 	{
 		--data.points_information[subset_point].subsets_covering_in_solution;
 		if(data.points_information[subset_point].subsets_covering_in_solution == 0)
@@ -549,7 +604,7 @@ void uscp::rwls::rwls::remove_subset(uscp::rwls::rwls::resolution_data& data,
 			// point newly uncovered
 			data.uncovered_points.set(subset_point);
 			const long long point_weight = data.points_information[subset_point].weight;
-			for(size_t neighbor: m_subsets_covering_points[subset_point])
+			for(size_t neighbor: m_problem.points_subsets_csr[subset_point])
 			{
 				data.subsets_information[neighbor].canAddToSolution = true;
 
@@ -561,7 +616,7 @@ void uscp::rwls::rwls::remove_subset(uscp::rwls::rwls::resolution_data& data,
 		{
 			// point now covered once
 			const long long point_weight = data.points_information[subset_point].weight;
-			for(size_t neighbor: m_subsets_covering_points[subset_point])
+			for(size_t neighbor: m_problem.points_subsets_csr[subset_point])
 			{
 				data.subsets_information[neighbor].canAddToSolution = true;
 
@@ -714,7 +769,7 @@ size_t uscp::rwls::rwls::select_subset_to_add(const uscp::rwls::rwls::resolution
 	std::pair<long long, long long> best_score_minus_timestamp(
 	  std::numeric_limits<long long>::min(), std::numeric_limits<long long>::max());
 	bool found = false;
-	for(size_t subset_covering: m_subsets_covering_points[point_to_cover])
+	for(size_t subset_covering: m_problem.points_subsets_csr[point_to_cover])
 	{
 		if(data.current_solution.selected_subsets.test(subset_covering))
 		{
@@ -767,7 +822,7 @@ std::optional<size_t> uscp::rwls::rwls::restricted_select_subset_to_add(
 	std::pair<long long, long long> best_score_minus_timestamp(
 	  std::numeric_limits<long long>::min(), std::numeric_limits<long long>::max());
 	bool found = false;
-	for(size_t subset_covering: m_subsets_covering_points[point_to_cover])
+	for(size_t subset_covering: m_problem.points_subsets_csr[point_to_cover])
 	{
 		if(!authorized_subsets.test(subset_covering))
 		{
@@ -819,7 +874,7 @@ size_t uscp::rwls::rwls::select_uncovered_point(uscp::rwls::rwls::resolution_dat
 	assert(data.uncovered_points.count() > 0);
 	size_t selected_point = 0;
 	std::uniform_int_distribution<size_t> uncovered_point_dist(0, data.uncovered_points.count());
-	const size_t selected_point_number = uncovered_point_dist(data.generator);
+	const size_t selected_point_number = uncovered_point_dist(*data.generator);
 	size_t current_point_number = 0;
 	data.uncovered_points.iterate_bits_on([&](size_t bit_on) noexcept {
 		if(++current_point_number >= selected_point_number)
@@ -838,7 +893,6 @@ uscp::solution uscp::rwls::improve(const uscp::solution& solution_initial,
                                    position stopping_criterion)
 {
 	rwls rwls(solution_initial.problem);
-	rwls.initialize();
 	report report = rwls.improve(solution_initial, generator, stopping_criterion);
 	return report.solution_final;
 }
@@ -848,7 +902,6 @@ uscp::rwls::report uscp::rwls::improve_report(const uscp::solution& solution_ini
                                               position stopping_criterion)
 {
 	rwls rwls(solution_initial.problem);
-	rwls.initialize();
 	report report = rwls.improve(solution_initial, generator, stopping_criterion);
 	return report;
 }
@@ -865,10 +918,13 @@ uscp::rwls::report uscp::rwls::expand(const uscp::rwls::report& reduced_report)
 	expanded_report.points_weights_initial = expand_points_info(
 	  reduced_report.solution_initial.problem, reduced_report.points_weights_initial);
 	expanded_report.solution_final = expand(reduced_report.solution_final);
+	expanded_report.solution_final_hash = solution_hash(expanded_report.solution_final);
 	expanded_report.points_weights_final = expand_points_info(reduced_report.solution_final.problem,
 	                                                          reduced_report.points_weights_final);
 	expanded_report.found_at = reduced_report.found_at;
 	expanded_report.ended_at = reduced_report.ended_at;
 	expanded_report.stopping_criterion = reduced_report.stopping_criterion;
+	expanded_report.target = reduced_report.target;
+	expanded_report.target_reached = reduced_report.target_reached;
 	return expanded_report;
 }
@@ -8,56 +8,146 @@
 #include "solver/data/instance.hpp"
 #include "common/utils/logger.hpp"
 #include "common/utils/timer.hpp"
+#include "common/utils/bits.hpp"
+#include "common/utils/file.hpp"
+#include "common/data/instances/binary.hpp"
 
 #include <cassert>
+#include <cstdint>
+#include <cstring>
 #include <vector>
-#include <fstream>
+#include <optional>
+#include <algorithm>
+#include <memory>
+
+namespace
+{
+	// Points generated from the same random stream, the generated instance does not depend on the
+	// threads number
+	constexpr size_t GENERATION_BLOCK_POINTS = 1 << 14;
+
+	// Sorted subsets covering each point
+	uscp::problem::sparse_rows generate_points_subsets(size_t points_number,
+	                                                   size_t subsets_number,
+	                                                   uint64_t seed,
+	                                                   size_t min_covering_subsets,
+	                                                   size_t max_covering_subsets) noexcept
+	{
+		using uscp::problem::sparse_rows;
+		assert(points_number > 0);
+		assert(subsets_number > 0);
+		assert(points_number <= sparse_rows::MAX_INDEX);
+		assert(subsets_number <= sparse_rows::MAX_INDEX);
+		assert(min_covering_subsets > 0);
+		assert(min_covering_subsets <= max_covering_subsets);
+		assert(max_covering_subsets <= subsets_number);
+
+		const size_t blocks_number =
+		  (points_number + GENERATION_BLOCK_POINTS - 1) / GENERATION_BLOCK_POINTS;
+		std::vector<std::vector<sparse_rows::index_type>> blocks_indexes(blocks_number);
+		std::vector<sparse_rows::offset_type> offsets(points_number + 1, 0);
+		const uscp::random_streams streams(seed);
+		// https://gcc.gnu.org/gcc-9/porting_to.html#ompdatasharing
+#if __GNUC__ < 9
+#	pragma omp parallel default(none) if(blocks_number > 1) \
+	  shared(points_number, subsets_number, min_covering_subsets, max_covering_subsets) \
+	  shared(blocks_indexes, offsets)
+#else
+#	pragma omp parallel default(none) if(blocks_number > 1) \
+	  shared(points_number, subsets_number, min_covering_subsets, max_covering_subsets) \
+	  shared(blocks_number, blocks_indexes, offsets, streams)
+#endif
+		{
+			// last point (+1) that selected each subset
+			std::vector<sparse_rows::index_type> subsets_selection(subsets_number, 0);
+#pragma omp for schedule(dynamic, 1)
+			for(/*no size_t for openMP on Windows*/ int i_block_int = 0;
+			    i_block_int < static_cast<int>(blocks_number);
+			    ++i_block_int)
+			{
+				const size_t i_block = static_cast<size_t>(i_block_int);
+				uscp::random_engine generator = streams.stream(i_block);
+				std::uniform_int_distribution<size_t> covering_subsets_number_dist(
+				  min_covering_subsets, max_covering_subsets);
+
+				std::vector<sparse_rows::index_type>& indexes = blocks_indexes[i_block];
+				const size_t first_point = i_block * GENERATION_BLOCK_POINTS;
+				const size_t last_point =
+				  std::min(first_point + GENERATION_BLOCK_POINTS, points_number);
+				for(size_t i_point = first_point; i_point < last_point; ++i_point)
+				{
+					const auto selection = static_cast<sparse_rows::index_type>(i_point + 1);
+					const size_t covering_subsets_number = covering_subsets_number_dist(generator);
+					const auto point_subsets_begin = static_cast<std::ptrdiff_t>(indexes.size());
+
+					// Floyd's sampling: distinct subsets without retries
+					for(size_t j = subsets_number - covering_subsets_number; j < subsets_number;
+					    ++j)
+					{
+						std::uniform_int_distribution<size_t> covering_subset_dist(0, j);
+						size_t covering_subset = covering_subset_dist(generator);
+						if(subsets_selection[covering_subset] == selection)
+						{
+							covering_subset = j;
+						}
+						subsets_selection[covering_subset] = selection;
+						indexes.push_back(static_cast<sparse_rows::index_type>(covering_subset));
+					}
+					std::sort(std::begin(indexes) + point_subsets_begin, std::end(indexes));
+					offsets[i_point + 1] = covering_subsets_number;
+				}
+			}
+		}
+
+		for(size_t i_point = 0; i_point < points_number; ++i_point)
+		{
+			offsets[i_point + 1] += offsets[i_point];
+		}
+		std::vector<sparse_rows::index_type> indexes(offsets.back());
+		// https://gcc.gnu.org/gcc-9/porting_to.html#ompdatasharing
+#if __GNUC__ < 9
+#	pragma omp parallel for default(none) schedule(dynamic, 1) if(blocks_number > 1) \
+	  shared(blocks_indexes, offsets, indexes)
+#else
+#	pragma omp parallel for default(none) schedule(dynamic, 1) if(blocks_number > 1) \
+	  shared(blocks_number, blocks_indexes, offsets, indexes)
+#endif
+		for(/*no size_t for openMP on Windows*/ int i_block_int = 0;
+		    i_block_int < static_cast<int>(blocks_number);
+		    ++i_block_int)
+		{
+			const size_t i_block = static_cast<size_t>(i_block_int);
+			std::vector<sparse_rows::index_type>& block_indexes = blocks_indexes[i_block];
+			std::copy(std::cbegin(block_indexes),
+			          std::cend(block_indexes),
+			          std::begin(indexes)
+			            + static_cast<std::ptrdiff_t>(offsets[i_block * GENERATION_BLOCK_POINTS]));
+			block_indexes = {};
+		}
+
+		return sparse_rows(std::move(offsets), std::move(indexes));
+	}
+} // namespace
 
 uscp::problem::instance uscp::problem::generate(std::string_view name,
                                                 size_t points_number,
                                                 size_t subsets_number,
-                                                uscp::random_engine& generator,
+                                                uint64_t seed,
                                                 size_t min_covering_subsets,
                                                 size_t max_covering_subsets) noexcept
 {
-
 	assert(!name.empty());
-	assert(points_number > 0);
-	assert(subsets_number > 0);
-	assert(min_covering_subsets > 0);
-	assert(max_covering_subsets > 0);
-	assert(min_covering_subsets <= max_covering_subsets);
-	assert(max_covering_subsets <= subsets_number);
-
 	const timer timer;
 
+	// points are visited in order by the transposition, the subsets rows are sorted
+	sparse_rows points_subsets = generate_points_subsets(
+	  points_number, subsets_number, seed, min_covering_subsets, max_covering_subsets);
+	sparse_rows subsets_points = transpose(points_subsets, subsets_number);
+
 	instance instance;
 	instance.name = name;
-	instance.points_number = points_number;
-	instance.subsets_number = subsets_number;
-	instance.subsets_points.resize(subsets_number);
-	for(dynamic_bitset<>& subset: instance.subsets_points)
-	{
-		subset.resize(points_number);
-	}
-
-	std::uniform_int_distribution<size_t> covering_subsets_number_dist(min_covering_subsets,
-	                                                                   max_covering_subsets);
-	std::uniform_int_distribution<size_t> covering_subset_dist(0, subsets_number - 1);
-	for(size_t i_point = 0; i_point < points_number; ++i_point)
-	{
-		const size_t covering_subsets_number = covering_subsets_number_dist(generator);
-		for(size_t i_subset_covering = 0; i_subset_covering < covering_subsets_number;
-		    ++i_subset_covering)
-		{
-			size_t covering_subset = covering_subset_dist(generator);
-			while(instance.subsets_points[covering_subset][i_point])
-			{
-				covering_subset = covering_subset_dist(generator);
-			}
-			instance.subsets_points[covering_subset][i_point].set();
-		}
-	}
+	set_subsets_points(
+	  instance, points_number, std::move(subsets_points), std::move(points_subsets));
 
 	LOGGER->info("successfully generated problem instance with {} points and {} subsets in {}s",
 	             points_number,
@@ -70,176 +160,891 @@ uscp::problem::instance uscp::problem::generate(std::string_view name,
 uscp::problem::instance uscp::problem::generate(std::string_view name,
                                                 size_t points_number,
                                                 size_t subsets_number,
-                                                uscp::random_engine& generator) noexcept
+                                                uint64_t seed) noexcept
 {
 	// Balas and Ho parameters
-	return generate(name, points_number, subsets_number, generator, 2, subsets_number);
+	return generate(name, points_number, subsets_number, seed, 2, subsets_number);
 }
 
-bool uscp::problem::has_solution(const uscp::problem::instance& instance) noexcept
+bool uscp::problem::generate_binary(const std::filesystem::path& path,
+                                    size_t points_number,
+                                    size_t subsets_number,
+                                    uint64_t seed,
+                                    size_t min_covering_subsets,
+                                    size_t max_covering_subsets,
+                                    bool override_file) noexcept
 {
-	dynamic_bitset<> cover(instance.points_number);
-	for(const auto& subset_points: instance.subsets_points)
+	const timer timer;
+
+	sparse_rows points_subsets = generate_points_subsets(
+	  points_number, subsets_number, seed, min_covering_subsets, max_covering_subsets);
+	const sparse_rows subsets_points = transpose(points_subsets, subsets_number);
+	if(!binary::write(subsets_points, points_subsets, path, override_file))
 	{
-		cover |= subset_points;
+		return false;
 	}
 
-	return cover.all();
+	LOGGER->info("successfully generated problem instance with {} points and {} subsets in {}s",
+	             points_number,
+	             subsets_number,
+	             timer.elapsed());
+	return true;
+}
+
+bool uscp::problem::has_solution(const uscp::problem::instance& instance) noexcept
+{
+	for(size_t i_point = 0; i_point < instance.points_number; ++i_point)
+	{
+		if(instance.points_subsets_csr[i_point].empty())
+		{
+			return false;
+		}
+	}
+	return true;
 }
 
 namespace
 {
-	[[gnu::hot]] bool reduce_domination_iterate(uscp::problem::reduction_info& reduction) noexcept;
+	// Uncovered points of a remaining subset, summarized for domination checks
+	struct domination_candidate final
+	{
+		size_t subset;
+		size_t points_number;
+		uint64_t signature; // one bit per hashed point, a subset can only include subsets of its signature
+		uint64_t hash;
+	};
+
+	// Incremental state of the reduction fixpoint: after the first full passes, a subset can only
+	// become dominated if some of its points were removed since the last domination pass, and a
+	// point can only lead to an inclusion if some of its covering subsets were dominated since the
+	// last inclusion pass
+	struct reduction_worklists final
+	{
+		dynamic_bitset<> points_removed; // covered or dominated points
+		std::vector<size_t> subsets_uncovered; // remaining points number of each subset
+		std::vector<size_t> points_degree; // remaining subsets covering each remaining point
+		std::vector<uint64_t> subsets_signature; // signature of all the points of each subset
+		std::vector<size_t> changed_subsets; // remaining subsets to check for domination
+		std::vector<size_t> changed_points; // remaining points to check for inclusion
+		std::vector<char> subsets_queued;
+		std::vector<char> points_queued;
+	};
+
+	// Remaining covering subsets of a remaining point, summarized for domination checks
+	struct point_domination_candidate final
+	{
+		size_t point;
+		size_t subsets_number;
+		uint64_t signature; // one bit per hashed subset
+		uint64_t hash;
+	};
+
+	[[nodiscard]] constexpr uint64_t point_signature(size_t point) noexcept
+	{
+		// Fibonacci hashing to spread consecutive points over the 64 signature bits
+		return uint64_t(1) << ((static_cast<uint64_t>(point) * UINT64_C(0x9E3779B97F4A7C15)) >> 58);
+	}
+
+	[[nodiscard]] constexpr uint64_t point_hash(uint64_t hash, size_t point) noexcept
+	{
+		// FNV-1a on point indexes
+		return (hash ^ static_cast<uint64_t>(point)) * UINT64_C(0x100000001B3);
+	}
+
+	// Under this density, domination candidates are enumerated from the subsets covering the
+	// rarest point of each subset instead of all larger subsets
+	constexpr double SPARSE_DOMINATION_MAX_DENSITY = 0.02;
+
+	[[gnu::hot]] bool reduce_domination(bool rarest_point_candidates,
+	                                    uscp::problem::reduction_info& reduction) noexcept;
+
+	[[nodiscard]] reduction_worklists make_worklists(
+	  const uscp::problem::reduction_info& reduction) noexcept;
 
-	[[gnu::hot]] bool reduce_domination(uscp::problem::reduction_info& reduction) noexcept;
+	[[gnu::hot]] bool reduce_domination(reduction_worklists& worklists,
+	                                    uscp::problem::reduction_info& reduction) noexcept;
 
-	[[gnu::hot]] bool reduce_inclusion(const std::vector<dynamic_bitset<>>& points_subsets,
+	[[gnu::hot]] bool reduce_inclusion(reduction_worklists& worklists,
 	                                   uscp::problem::reduction_info& reduction) noexcept;
 
+	[[gnu::hot]] bool reduce_points_domination(
+	  reduction_worklists& worklists,
+	  uscp::problem::reduction_info& reduction) noexcept;
+
 	[[gnu::hot]] uscp::problem::reduction_info compute_reduction(
 	  const uscp::problem::instance& full_instance) noexcept;
 
-	[[gnu::hot]] uscp::problem::instance apply_reduction(
-	  uscp::problem::reduction_info reduction) noexcept;
+	// Inclusion rule only, O(points + covering number)
+	[[gnu::hot]] uscp::problem::reduction_info compute_inclusion_reduction(
+	  const uscp::problem::instance& instance) noexcept;
+
+	// the dense form of the reduced instance is only built if dense_form
+	[[gnu::hot]] uscp::problem::instance apply_reduction(uscp::problem::reduction_info reduction,
+	                                                     bool dense_form = true) noexcept;
 
-	bool reduce_domination_iterate(uscp::problem::reduction_info& reduction) noexcept
+	using point_indexes = std::vector<uscp::problem::sparse_rows::index_type>;
+
+	// uncovered points of the subset, sorted
+	void uncovered_points(const uscp::problem::instance& instance,
+	                      size_t subset,
+	                      const dynamic_bitset<>& points_covered,
+	                      point_indexes& subset_points) noexcept
+	{
+		subset_points.clear();
+		for(uscp::problem::sparse_rows::index_type point: instance.subsets_points_csr[subset])
+		{
+			if(!points_covered[point])
+			{
+				subset_points.push_back(point);
+			}
+		}
+	}
+
+	[[nodiscard]] bool is_included(const uscp::problem::instance& instance,
+	                               const point_indexes& subset_points,
+	                               const domination_candidate& candidate,
+	                               const domination_candidate& other) noexcept
+	{
+		if((candidate.signature & ~other.signature) != 0)
+		{
+			return false;
+		}
+		return uscp::problem::is_subset_of(subset_points.data(),
+		                                   subset_points.data() + subset_points.size(),
+		                                   instance.subsets_points_csr[other.subset]);
+	}
+
+	// true if the remaining subsets covering candidate all cover other
+	[[nodiscard]] bool is_cover_included(const uscp::problem::instance& instance,
+	                                     const dynamic_bitset<>& subsets_dominated,
+	                                     const point_domination_candidate& candidate,
+	                                     const point_domination_candidate& other) noexcept
+	{
+		if((candidate.signature & ~other.signature) != 0)
+		{
+			return false;
+		}
+		for(size_t subset: instance.points_subsets_csr[candidate.point])
+		{
+			if(!subsets_dominated[subset]
+			   && !instance.subsets_points_csr.contains(subset, other.point))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	// A remaining subset is dominated if its uncovered points are a strict subset of the uncovered
+	// points of another remaining subset, or if they are equal to the ones of a remaining subset
+	// with a lower index (identical subsets: the first one is kept).
+	// Each decision only depends on the reduction state at the start of the pass: threads record
+	// their findings in their own slots and the dominated subsets are applied after the loops, the
+	// result does not depend on the threads number.
+	bool reduce_domination(bool rarest_point_candidates,
+	                       uscp::problem::reduction_info& reduction) noexcept
 	{
 		timer timer;
-		bool reduced = false;
-		dynamic_bitset<> remaining_subsets = ~(reduction.reduction_applied.subsets_dominated
-		                                       | reduction.reduction_applied.subsets_included);
-		remaining_subsets.iterate_bits_on([&](size_t current_subset_bit_on) {
-			dynamic_bitset<> extended_subset =
-			  (reduction.parent_instance->subsets_points[current_subset_bit_on]
-			   | reduction.reduction_applied.points_covered);
-			remaining_subsets.iterate_bits_on([&](size_t other_subset_bit_on) {
-				if(reduction.parent_instance->subsets_points[other_subset_bit_on].is_subset_of(
-				     extended_subset))
+		const uscp::problem::instance& instance = *reduction.parent_instance;
+		const dynamic_bitset<>& points_covered = reduction.reduction_applied.points_covered;
+		const dynamic_bitset<> ignored_subsets = reduction.reduction_applied.subsets_dominated
+		                                         | reduction.reduction_applied.subsets_included;
+		std::vector<size_t> remaining_subsets;
+		remaining_subsets.reserve(instance.subsets_number - ignored_subsets.count());
+		for(size_t i_subset = 0; i_subset < instance.subsets_number; ++i_subset)
+		{
+			if(!ignored_subsets[i_subset])
+			{
+				remaining_subsets.push_back(i_subset);
+			}
+		}
+		const bool parallel = remaining_subsets.size() > 128;
+
+		// Summarize the uncovered points of the remaining subsets
+		std::vector<domination_candidate> candidates(remaining_subsets.size());
+#pragma omp parallel for default(none) schedule(dynamic, 64) if(parallel) \
+	  shared(remaining_subsets, candidates, instance, points_covered)
+		for(/*no size_t for openMP on Windows*/ int i_int = 0;
+		    i_int < static_cast<int>(remaining_subsets.size());
+		    ++i_int)
+		{
+			const size_t i = static_cast<size_t>(i_int);
+			domination_candidate& candidate = candidates[i];
+			candidate = {remaining_subsets[i], 0, 0, UINT64_C(0xCBF29CE484222325)};
+			for(size_t point: instance.subsets_points_csr[candidate.subset])
+			{
+				if(points_covered[point])
 				{
-					reduction.reduction_applied.subsets_dominated.set(other_subset_bit_on);
-					remaining_subsets.reset(other_subset_bit_on);
-					reduced = true;
+					continue;
 				}
-			});
-		});
+				++candidate.points_number;
+				candidate.signature |= point_signature(point);
+				candidate.hash = point_hash(candidate.hash, point);
+			}
+		}
+
+		// Remaining subsets covering each point
+		std::vector<size_t> points_degree;
+		if(rarest_point_candidates)
+		{
+			points_degree.resize(instance.points_number, 0);
+			// https://gcc.gnu.org/gcc-9/porting_to.html#ompdatasharing
+#if __GNUC__ < 9
+#	pragma omp parallel for default(none) schedule(dynamic, 256) if(parallel) \
+	  shared(instance, points_covered, points_degree)
+#else
+#	pragma omp parallel for default(none) schedule(dynamic, 256) if(parallel) \
+	  shared(instance, points_covered, ignored_subsets, points_degree)
+#endif
+			for(/*no size_t for openMP on Windows*/ int i_point_int = 0;
+			    i_point_int < static_cast<int>(instance.points_number);
+			    ++i_point_int)
+			{
+				const size_t i_point = static_cast<size_t>(i_point_int);
+				if(points_covered[i_point])
+				{
+					continue;
+				}
+				for(size_t subset: instance.points_subsets_csr[i_point])
+				{
+					if(!ignored_subsets[subset])
+					{
+						++points_degree[i_point];
+					}
+				}
+			}
+		}
+
+		// Largest subsets first, identical subsets are adjacent and ordered by index
+		std::sort(std::begin(candidates),
+		          std::end(candidates),
+		          [](const domination_candidate& lhs, const domination_candidate& rhs) noexcept {
+			          if(lhs.points_number != rhs.points_number)
+			          {
+				          return lhs.points_number > rhs.points_number;
+			          }
+			          if(lhs.hash != rhs.hash)
+			          {
+				          return lhs.hash < rhs.hash;
+			          }
+			          return lhs.subset < rhs.subset;
+		          });
+
+		// Identical subsets: keep the first of each group (same cardinality: inclusion is equality)
+		std::vector<size_t> groups_begin;
+		for(size_t i = 0; i < candidates.size(); ++i)
+		{
+			if(i == 0 || candidates[i].points_number != candidates[i - 1].points_number
+			   || candidates[i].hash != candidates[i - 1].hash)
+			{
+				groups_begin.push_back(i);
+			}
+		}
+		groups_begin.push_back(candidates.size());
+		std::vector<char> duplicate_candidates(candidates.size(), false);
+		point_indexes subset_points; // uncovered points of the tested subset
+#pragma omp parallel for default(none) schedule(dynamic, 64) if(parallel) \
+	  firstprivate(subset_points) \
+	  shared(groups_begin, candidates, duplicate_candidates) \
+	  shared(instance, points_covered)
+		for(/*no size_t for openMP on Windows*/ int i_group_int = 0;
+		    i_group_int < static_cast<int>(groups_begin.size()) - 1;
+		    ++i_group_int)
+		{
+			const size_t i_group = static_cast<size_t>(i_group_int);
+			for(size_t i = groups_begin[i_group] + 1; i < groups_begin[i_group + 1]; ++i)
+			{
+				uncovered_points(instance, candidates[i].subset, points_covered, subset_points);
+				for(size_t j = groups_begin[i_group]; j < i; ++j)
+				{
+					if(!duplicate_candidates[j]
+					   && is_included(instance, subset_points, candidates[i], candidates[j]))
+					{
+						duplicate_candidates[i] = true;
+						break;
+					}
+				}
+			}
+		}
+		std::vector<domination_candidate> unique_candidates;
+		unique_candidates.reserve(candidates.size());
+		for(size_t i = 0; i < candidates.size(); ++i)
+		{
+			if(!duplicate_candidates[i])
+			{
+				unique_candidates.push_back(candidates[i]);
+			}
+		}
+
+		// Strict inclusions: only test against larger subsets
+		std::vector<size_t> larger_ends(unique_candidates.size(), 0);
+		for(size_t i = 1; i < unique_candidates.size(); ++i)
+		{
+			larger_ends[i] =
+			  unique_candidates[i].points_number == unique_candidates[i - 1].points_number
+			    ? larger_ends[i - 1]
+			    : i;
+		}
+		std::vector<size_t> unique_positions; // position of each subset in unique_candidates
+		if(rarest_point_candidates)
+		{
+			unique_positions.resize(instance.subsets_number, unique_candidates.size());
+			for(size_t i = 0; i < unique_candidates.size(); ++i)
+			{
+				unique_positions[unique_candidates[i].subset] = i;
+			}
+		}
+		std::vector<char> dominated_candidates(unique_candidates.size(), false);
+#pragma omp parallel for default(none) schedule(dynamic, 64) if(parallel) \
+	  firstprivate(subset_points) \
+	  shared(unique_candidates, larger_ends, dominated_candidates, unique_positions) \
+	  shared(instance, points_covered, points_degree, rarest_point_candidates)
+		for(/*no size_t for openMP on Windows*/ int i_int = 0;
+		    i_int < static_cast<int>(unique_candidates.size());
+		    ++i_int)
+		{
+			const size_t i = static_cast<size_t>(i_int);
+			const domination_candidate& candidate = unique_candidates[i];
+			const size_t larger_end = larger_ends[i];
+			if(larger_end == 0)
+			{
+				continue;
+			}
+			if(rarest_point_candidates && candidate.points_number == 0)
+			{
+				// no uncovered point: included in any larger subset
+				dominated_candidates[i] = true;
+				continue;
+			}
+			uncovered_points(instance, candidate.subset, points_covered, subset_points);
+			if(rarest_point_candidates)
+			{
+				// a dominating subset covers the rarest point of the subset
+				size_t rarest_point = subset_points.front();
+				for(size_t point: subset_points)
+				{
+					if(points_degree[point] < points_degree[rarest_point])
+					{
+						rarest_point = point;
+					}
+				}
+				for(size_t other_subset: instance.points_subsets_csr[rarest_point])
+				{
+					const size_t other_position = unique_positions[other_subset];
+					if(other_position < larger_end
+					   && is_included(
+					     instance, subset_points, candidate, unique_candidates[other_position]))
+					{
+						dominated_candidates[i] = true;
+						break;
+					}
+				}
+			}
+			else
+			{
+				for(size_t j = 0; j < larger_end; ++j)
+				{
+					if(is_included(instance, subset_points, candidate, unique_candidates[j]))
+					{
+						dominated_candidates[i] = true;
+						break;
+					}
+				}
+			}
+		}
+
+		// Merge findings
+		std::vector<size_t> dominated_subsets;
+		for(size_t i = 0; i < candidates.size(); ++i)
+		{
+			if(duplicate_candidates[i])
+			{
+				dominated_subsets.push_back(candidates[i].subset);
+			}
+		}
+		for(size_t i = 0; i < unique_candidates.size(); ++i)
+		{
+			if(dominated_candidates[i])
+			{
+				dominated_subsets.push_back(unique_candidates[i].subset);
+			}
+		}
+		std::sort(std::begin(dominated_subsets), std::end(dominated_subsets));
+		for(size_t subset: dominated_subsets)
+		{
+			reduction.reduction_applied.subsets_dominated.set(subset);
+		}
 		SPDLOG_LOGGER_DEBUG(LOGGER,
-		                    "({}) Applied domination reduction in {}s",
+		                    "({}) Computed domination reduction in {}s",
 		                    reduction.parent_instance->name,
 		                    timer.elapsed());
-		return reduced;
+		return !dominated_subsets.empty();
 	}
 
-	bool reduce_domination(uscp::problem::reduction_info& reduction) noexcept
+	reduction_worklists make_worklists(const uscp::problem::reduction_info& reduction) noexcept
+	{
+		const uscp::problem::instance& instance = *reduction.parent_instance;
+		const uscp::problem::reduction& reduction_applied = reduction.reduction_applied;
+		reduction_worklists worklists;
+		worklists.points_removed =
+		  reduction_applied.points_covered | reduction_applied.points_dominated;
+		worklists.subsets_uncovered.resize(instance.subsets_number, 0);
+		worklists.subsets_signature.resize(instance.subsets_number, 0);
+		for(size_t i_subset = 0; i_subset < instance.subsets_number; ++i_subset)
+		{
+			for(size_t point: instance.subsets_points_csr[i_subset])
+			{
+				worklists.subsets_signature[i_subset] |= point_signature(point);
+				if(!worklists.points_removed[point])
+				{
+					++worklists.subsets_uncovered[i_subset];
+				}
+			}
+		}
+		worklists.points_degree.resize(instance.points_number, 0);
+		for(size_t i_point = 0; i_point < instance.points_number; ++i_point)
+		{
+			if(worklists.points_removed[i_point])
+			{
+				continue;
+			}
+			for(size_t subset: instance.points_subsets_csr[i_point])
+			{
+				if(!reduction_applied.subsets_dominated[subset]
+				   && !reduction_applied.subsets_included[subset])
+				{
+					++worklists.points_degree[i_point];
+				}
+			}
+			// the first inclusion pass checks all the points
+			worklists.changed_points.push_back(i_point);
+		}
+		worklists.subsets_queued.resize(instance.subsets_number, false);
+		worklists.points_queued.resize(instance.points_number, false);
+		return worklists;
+	}
+
+	// Same rule as the full pass, restricted to the changed subsets: a dominating subset covers the
+	// rarest uncovered point of the tested subset.
+	// Each decision only depends on the reduction state at the start of the pass.
+	bool reduce_domination(reduction_worklists& worklists,
+	                       uscp::problem::reduction_info& reduction) noexcept
 	{
 		timer timer;
-		bool reduced = false;
-		dynamic_bitset<> ignored_subsets = reduction.reduction_applied.subsets_dominated
-		                                   | reduction.reduction_applied.subsets_included;
-		dynamic_bitset<> extended_subset; // to minimize memory allocations
-#pragma omp parallel for default(none) shared(reduction, ignored_subsets, reduced) private( \
-  extended_subset) if(reduction.parent_instance->subsets_number > 128)
-		for(/*no size_t for openMP on Windows*/ int i_current_subset_int = 0;
-		    static_cast<size_t>(i_current_subset_int) < reduction.parent_instance->subsets_number;
-		    ++i_current_subset_int)
-		{
-			const size_t i_current_subset = static_cast<size_t>(i_current_subset_int);
-			if(ignored_subsets[i_current_subset])
-			{
-				// possible concurrent access when a dominated subset is added
-				// not a problem: it will just check if a dominated subset dominate other subsets and domination is transitive
+		const uscp::problem::instance& instance = *reduction.parent_instance;
+		const dynamic_bitset<>& points_removed = worklists.points_removed;
+		const dynamic_bitset<>& subsets_dominated = reduction.reduction_applied.subsets_dominated;
+		const dynamic_bitset<>& subsets_included = reduction.reduction_applied.subsets_included;
+		const std::vector<size_t>& changed_subsets = worklists.changed_subsets;
+
+		// Without remaining points, all remaining subsets are identical: keep the first one
+		const bool all_removed = points_removed.all();
+		size_t first_remaining_subset = 0;
+		while(all_removed && first_remaining_subset < instance.subsets_number
+		      && (subsets_dominated[first_remaining_subset]
+		          || subsets_included[first_remaining_subset]))
+		{
+			++first_remaining_subset;
+		}
+
+		const bool parallel = changed_subsets.size() > 128;
+		std::vector<char> dominated_changed(changed_subsets.size(), false);
+		point_indexes subset_points; // remaining points of the tested subset
+		// https://gcc.gnu.org/gcc-9/porting_to.html#ompdatasharing
+#if __GNUC__ < 9
+#	pragma omp parallel for default(none) schedule(dynamic, 64) if(parallel) \
+	  firstprivate(subset_points) \
+	  shared(changed_subsets, worklists, first_remaining_subset, dominated_changed) \
+	  shared(points_removed, instance, subsets_dominated, subsets_included)
+#else
+#	pragma omp parallel for default(none) schedule(dynamic, 64) if(parallel) \
+	  firstprivate(subset_points) \
+	  shared(changed_subsets, worklists, first_remaining_subset, dominated_changed) \
+	  shared(points_removed, instance, subsets_dominated, subsets_included, all_removed)
+#endif
+		for(/*no size_t for openMP on Windows*/ int i_int = 0;
+		    i_int < static_cast<int>(changed_subsets.size());
+		    ++i_int)
+		{
+			const size_t i = static_cast<size_t>(i_int);
+			const size_t subset = changed_subsets[i];
+			const size_t uncovered = worklists.subsets_uncovered[subset];
+			if(uncovered == 0)
+			{
+				// included in any subset covering a remaining point
+				dominated_changed[i] = !all_removed || subset != first_remaining_subset;
 				continue;
 			}
-			extended_subset = reduction.parent_instance->subsets_points[i_current_subset];
-			extended_subset |= reduction.reduction_applied.points_covered;
-			for(size_t i_other_subset = 0;
-			    i_other_subset < reduction.parent_instance->subsets_number;
-			    ++i_other_subset)
+			uncovered_points(instance, subset, points_removed, subset_points);
+			uint64_t signature = 0;
+			size_t rarest_point = subset_points.front();
+			for(size_t point: subset_points)
 			{
-				if(i_other_subset == i_current_subset)
+				signature |= point_signature(point);
+				if(worklists.points_degree[point] < worklists.points_degree[rarest_point])
+				{
+					rarest_point = point;
+				}
+			}
+			for(size_t other_subset: instance.points_subsets_csr[rarest_point])
+			{
+				if(other_subset == subset || subsets_dominated[other_subset]
+				   || subsets_included[other_subset])
 				{
 					continue;
 				}
-				if(ignored_subsets[i_other_subset])
+				const size_t other_uncovered = worklists.subsets_uncovered[other_subset];
+				// strict inclusion in a larger subset or identical to a subset with a lower index
+				if(other_uncovered < uncovered
+				   || (other_uncovered == uncovered && other_subset > subset))
+				{
+					continue;
+				}
+				if((signature & ~worklists.subsets_signature[other_subset]) == 0
+				   && uscp::problem::is_subset_of(subset_points.data(),
+				                                  subset_points.data() + subset_points.size(),
+				                                  instance.subsets_points_csr[other_subset]))
+				{
+					dominated_changed[i] = true;
+					break;
+				}
+			}
+		}
+
+		// Merge findings
+		std::vector<size_t> dominated_subsets;
+		for(size_t i = 0; i < changed_subsets.size(); ++i)
+		{
+			if(dominated_changed[i])
+			{
+				dominated_subsets.push_back(changed_subsets[i]);
+			}
+			worklists.subsets_queued[changed_subsets[i]] = false;
+		}
+		worklists.changed_subsets.clear();
+		std::sort(std::begin(dominated_subsets), std::end(dominated_subsets));
+		for(size_t subset: dominated_subsets)
+		{
+			reduction.reduction_applied.subsets_dominated.set(subset);
+			for(size_t point: instance.subsets_points_csr[subset])
+			{
+				if(points_removed[point])
 				{
-					// possible concurrent access when a dominated subset is added
-					// not a problem: it will just check if an already dominated subset is dominated
 					continue;
 				}
-				if(reduction.parent_instance->subsets_points[i_other_subset].is_subset_of(
-				     extended_subset))
+				--worklists.points_degree[point];
+				if(!worklists.points_queued[point])
 				{
-					reduction.reduction_applied.subsets_dominated.set(i_other_subset);
-					ignored_subsets.set(i_other_subset);
-					reduced = true;
+					worklists.points_queued[point] = true;
+					worklists.changed_points.push_back(point);
 				}
 			}
 		}
 		SPDLOG_LOGGER_DEBUG(LOGGER,
-		                    "({}) Computed domination reduction in {}s",
+		                    "({}) Computed domination reduction of {} changed subsets in {}s",
 		                    reduction.parent_instance->name,
+		                    changed_subsets.size(),
 		                    timer.elapsed());
-		return reduced;
+		return !dominated_subsets.empty();
 	}
 
-	bool reduce_inclusion(const std::vector<dynamic_bitset<>>& points_subsets,
+	// A point covered by a single non-dominated subset forces the inclusion of this subset, only
+	// the changed points are checked
+	bool reduce_inclusion(reduction_worklists& worklists,
 	                      uscp::problem::reduction_info& reduction) noexcept
 	{
 		timer timer;
-		bool reduced = false;
-		dynamic_bitset<> points_remaining_subsets;
-		for(size_t i_point = 0; i_point < reduction.parent_instance->points_number; ++i_point)
+		const uscp::problem::instance& instance = *reduction.parent_instance;
+		uscp::problem::reduction& reduction_applied = reduction.reduction_applied;
+		std::vector<size_t> included_subsets;
+		for(size_t point: worklists.changed_points)
 		{
-			if(reduction.reduction_applied.points_covered[i_point])
+			worklists.points_queued[point] = false;
+			if(worklists.points_removed[point])
 			{
 				continue;
 			}
-			points_remaining_subsets = points_subsets[i_point];
-			points_remaining_subsets -= reduction.reduction_applied.subsets_dominated;
-			assert(points_remaining_subsets.any());
-			if(points_remaining_subsets.count() == 1)
+			assert(worklists.points_degree[point] > 0);
+			if(worklists.points_degree[point] != 1)
 			{
-				const size_t only_subset_covering_point = points_remaining_subsets.find_first();
-				reduction.reduction_applied.subsets_included.set(only_subset_covering_point);
-				reduction.parent_instance->subsets_points[only_subset_covering_point]
-				  .iterate_bits_on([&](size_t bit_on) noexcept {
-					  reduction.reduction_applied.points_covered.set(bit_on);
-				  });
-				reduced = true;
+				continue;
+			}
+			for(size_t subset: instance.points_subsets_csr[point])
+			{
+				if(!reduction_applied.subsets_dominated[subset])
+				{
+					if(!reduction_applied.subsets_included[subset])
+					{
+						reduction_applied.subsets_included.set(subset);
+						included_subsets.push_back(subset);
+					}
+					break;
+				}
+			}
+		}
+		const size_t changed_points_number = worklists.changed_points.size();
+		worklists.changed_points.clear();
+
+		// Cover the points of the included subsets, the remaining subsets covering them changed
+		for(size_t included_subset: included_subsets)
+		{
+			for(size_t point: instance.subsets_points_csr[included_subset])
+			{
+				if(worklists.points_removed[point])
+				{
+					continue;
+				}
+				reduction_applied.points_covered.set(point);
+				worklists.points_removed.set(point);
+				for(size_t subset: instance.points_subsets_csr[point])
+				{
+					--worklists.subsets_uncovered[subset];
+					if(!worklists.subsets_queued[subset]
+					   && !reduction_applied.subsets_dominated[subset]
+					   && !reduction_applied.subsets_included[subset])
+					{
+						worklists.subsets_queued[subset] = true;
+						worklists.changed_subsets.push_back(subset);
+					}
+				}
 			}
 		}
 		SPDLOG_LOGGER_DEBUG(LOGGER,
-		                    "({}) Computed inclusion reduction in {}s",
+		                    "({}) Computed inclusion reduction of {} changed points in {}s",
 		                    reduction.parent_instance->name,
+		                    changed_points_number,
 		                    timer.elapsed());
-		return reduced;
+		return !included_subsets.empty();
 	}
 
-	uscp::problem::reduction_info compute_reduction(
-	  const uscp::problem::instance& full_instance) noexcept
+	// A remaining point is dominated if its remaining covering subsets are a strict superset of the
+	// ones of another remaining point, or if they are equal to the ones of a remaining point with a
+	// lower index (identical points: the first one is kept): any cover of the other point covers
+	// it.
+	// Each decision only depends on the reduction state at the start of the pass.
+	bool reduce_points_domination(reduction_worklists& worklists,
+	                              uscp::problem::reduction_info& reduction) noexcept
 	{
-		const timer timer;
+		timer timer;
+		const uscp::problem::instance& instance = *reduction.parent_instance;
+		const dynamic_bitset<>& subsets_dominated = reduction.reduction_applied.subsets_dominated;
+		std::vector<size_t> remaining_points;
+		remaining_points.reserve(instance.points_number - worklists.points_removed.count());
+		for(size_t i_point = 0; i_point < instance.points_number; ++i_point)
+		{
+			if(!worklists.points_removed[i_point])
+			{
+				remaining_points.push_back(i_point);
+			}
+		}
+		const bool parallel = remaining_points.size() > 128;
+
+		// Summarize the remaining covering subsets of the remaining points
+		std::vector<point_domination_candidate> candidates(remaining_points.size());
+#pragma omp parallel for default(none) schedule(dynamic, 64) if(parallel) \
+	  shared(remaining_points, candidates, instance, subsets_dominated)
+		for(/*no size_t for openMP on Windows*/ int i_int = 0;
+		    i_int < static_cast<int>(remaining_points.size());
+		    ++i_int)
+		{
+			const size_t i = static_cast<size_t>(i_int);
+			point_domination_candidate& candidate = candidates[i];
+			candidate = {remaining_points[i], 0, 0, UINT64_C(0xCBF29CE484222325)};
+			for(size_t subset: instance.points_subsets_csr[candidate.point])
+			{
+				if(subsets_dominated[subset])
+				{
+					continue;
+				}
+				++candidate.subsets_number;
+				candidate.signature |= point_signature(subset);
+				candidate.hash = point_hash(candidate.hash, subset);
+			}
+		}
+
+		// Smallest covers first, identical covers are adjacent and ordered by index
+		std::sort(std::begin(candidates),
+		          std::end(candidates),
+		          [](const point_domination_candidate& lhs,
+		             const point_domination_candidate& rhs) noexcept {
+			          if(lhs.subsets_number != rhs.subsets_number)
+			          {
+				          return lhs.subsets_number < rhs.subsets_number;
+			          }
+			          if(lhs.hash != rhs.hash)
+			          {
+				          return lhs.hash < rhs.hash;
+			          }
+			          return lhs.point < rhs.point;
+		          });
+
+		// Identical covers: keep the first of each group (same cardinality: inclusion is equality)
+		std::vector<size_t> groups_begin;
+		for(size_t i = 0; i < candidates.size(); ++i)
+		{
+			if(i == 0 || candidates[i].subsets_number != candidates[i - 1].subsets_number
+			   || candidates[i].hash != candidates[i - 1].hash)
+			{
+				groups_begin.push_back(i);
+			}
+		}
+		groups_begin.push_back(candidates.size());
+		std::vector<char> duplicate_candidates(candidates.size(), false);
+#pragma omp parallel for default(none) schedule(dynamic, 64) if(parallel) \
+	  shared(groups_begin, duplicate_candidates, candidates, instance, subsets_dominated)
+		for(/*no size_t for openMP on Windows*/ int i_group_int = 0;
+		    i_group_int < static_cast<int>(groups_begin.size()) - 1;
+		    ++i_group_int)
+		{
+			const size_t i_group = static_cast<size_t>(i_group_int);
+			for(size_t i = groups_begin[i_group] + 1; i < groups_begin[i_group + 1]; ++i)
+			{
+				for(size_t j = groups_begin[i_group]; j < i; ++j)
+				{
+					if(!duplicate_candidates[j]
+					   && is_cover_included(
+					     instance, subsets_dominated, candidates[j], candidates[i]))
+					{
+						duplicate_candidates[i] = true;
+						break;
+					}
+				}
+			}
+		}
+		std::vector<point_domination_candidate> unique_candidates;
+		unique_candidates.reserve(candidates.size());
+		for(size_t i = 0; i < candidates.size(); ++i)
+		{
+			if(!duplicate_candidates[i])
+			{
+				unique_candidates.push_back(candidates[i]);
+			}
+		}
 
-		// Generate flipped instance matrix
-		std::vector<dynamic_bitset<>> points_subsets;
-		points_subsets.resize(full_instance.points_number);
-		for(dynamic_bitset<>& point_subsets: points_subsets)
+		// Strict inclusions: a point whose cover includes the cover of a smaller one is covered by
+		// the smallest subset covering the smaller one
+		std::vector<size_t> larger_begins(unique_candidates.size(), unique_candidates.size());
+		for(size_t i = unique_candidates.size(); i-- > 1;)
 		{
-			point_subsets.resize(full_instance.subsets_number);
+			larger_begins[i - 1] =
+			  unique_candidates[i].subsets_number == unique_candidates[i - 1].subsets_number
+			    ? larger_begins[i]
+			    : i;
 		}
-		for(size_t i_subset = 0; i_subset < full_instance.subsets_number; ++i_subset)
+		// position of each point in unique_candidates
+		std::vector<size_t> unique_positions(instance.points_number, unique_candidates.size());
+		for(size_t i = 0; i < unique_candidates.size(); ++i)
 		{
-			full_instance.subsets_points[i_subset].iterate_bits_on([&](
-			  size_t point_bit_on) noexcept { points_subsets[point_bit_on].set(i_subset); });
+			unique_positions[unique_candidates[i].point] = i;
+		}
+		std::vector<size_t> dominated_points;
+#pragma omp parallel default(none) if(parallel) \
+	  shared(unique_candidates, larger_begins, unique_positions, dominated_points) \
+	  shared(instance, subsets_dominated, worklists)
+		{
+			std::vector<size_t> thread_dominated_points;
+#pragma omp for schedule(dynamic, 64) nowait
+			for(/*no size_t for openMP on Windows*/ int i_int = 0;
+			    i_int < static_cast<int>(unique_candidates.size());
+			    ++i_int)
+			{
+				const size_t i = static_cast<size_t>(i_int);
+				const point_domination_candidate& candidate = unique_candidates[i];
+				const size_t larger_begin = larger_begins[i];
+				if(larger_begin == unique_candidates.size())
+				{
+					continue;
+				}
+				size_t smallest_subset = instance.subsets_number;
+				for(size_t subset: instance.points_subsets_csr[candidate.point])
+				{
+					if(!subsets_dominated[subset]
+					   && (smallest_subset == instance.subsets_number
+					       || worklists.subsets_uncovered[subset]
+					            < worklists.subsets_uncovered[smallest_subset]))
+					{
+						smallest_subset = subset;
+					}
+				}
+				assert(smallest_subset != instance.subsets_number);
+				for(size_t point: instance.subsets_points_csr[smallest_subset])
+				{
+					const size_t other_position = unique_positions[point];
+					if(other_position >= larger_begin && other_position < unique_candidates.size()
+					   && is_cover_included(instance,
+					                        subsets_dominated,
+					                        candidate,
+					                        unique_candidates[other_position]))
+					{
+						thread_dominated_points.push_back(point);
+					}
+				}
+			}
+#pragma omp critical(uscp_points_domination)
+			dominated_points.insert(std::end(dominated_points),
+			                        std::begin(thread_dominated_points),
+			                        std::end(thread_dominated_points));
 		}
 
+		// Merge findings
+		for(size_t i = 0; i < candidates.size(); ++i)
+		{
+			if(duplicate_candidates[i])
+			{
+				dominated_points.push_back(candidates[i].point);
+			}
+		}
+		std::sort(std::begin(dominated_points), std::end(dominated_points));
+		dominated_points.erase(
+		  std::unique(std::begin(dominated_points), std::end(dominated_points)),
+		  std::end(dominated_points));
+		for(size_t point: dominated_points)
+		{
+			reduction.reduction_applied.points_dominated.set(point);
+			worklists.points_removed.set(point);
+			for(size_t subset: instance.points_subsets_csr[point])
+			{
+				--worklists.subsets_uncovered[subset];
+				if(!worklists.subsets_queued[subset] && !subsets_dominated[subset]
+				   && !reduction.reduction_applied.subsets_included[subset])
+				{
+					worklists.subsets_queued[subset] = true;
+					worklists.changed_subsets.push_back(subset);
+				}
+			}
+		}
+		SPDLOG_LOGGER_DEBUG(LOGGER,
+		                    "({}) Computed points domination reduction in {}s",
+		                    reduction.parent_instance->name,
+		                    timer.elapsed());
+		return !dominated_points.empty();
+	}
+
+	uscp::problem::reduction_info compute_reduction(
+	  const uscp::problem::instance& full_instance) noexcept
+	{
+		const timer timer;
+
+		const size_t covering_number = full_instance.subsets_points_csr.indexes_number();
+		const bool rarest_point_candidates =
+		  static_cast<double>(covering_number)
+		  < SPARSE_DOMINATION_MAX_DENSITY * static_cast<double>(full_instance.points_number)
+		      * static_cast<double>(full_instance.subsets_number);
+
 		// Compute reduction
 		uscp::problem::reduction_info reduction(&full_instance);
-		reduce_domination(reduction);
-		if(reduce_inclusion(points_subsets, reduction))
+		reduce_domination(rarest_point_candidates, reduction);
+		reduction_worklists worklists = make_worklists(reduction);
+		do
 		{
-			while(reduce_domination(reduction) && reduce_inclusion(points_subsets, reduction))
-				;
-		}
+			if(reduce_inclusion(worklists, reduction))
+			{
+				while(reduce_domination(worklists, reduction)
+				      && reduce_inclusion(worklists, reduction))
+					;
+			}
+		} while(reduce_points_domination(worklists, reduction)
+		        && reduce_domination(worklists, reduction));
 		if((reduction.reduction_applied.subsets_included
 		    & reduction.reduction_applied.subsets_dominated)
 		     .any())
@@ -252,71 +1057,114 @@ namespace
 		return reduction;
 	}
 
-	uscp::problem::instance apply_reduction(uscp::problem::reduction_info reduction) noexcept
+	uscp::problem::reduction_info compute_inclusion_reduction(
+	  const uscp::problem::instance& instance) noexcept
+	{
+		// without domination, including subsets doesn't change the covering subsets of the other
+		// points: a single pass over all the points reaches the fixpoint
+		uscp::problem::reduction_info reduction(&instance);
+		reduction_worklists worklists = make_worklists(reduction);
+		reduce_inclusion(worklists, reduction);
+		return reduction;
+	}
+
+	uscp::problem::instance apply_reduction(uscp::problem::reduction_info reduction,
+	                                        bool dense_form) noexcept
 	{
 		const timer timer;
 
+		const uscp::problem::instance& full_instance = *reduction.parent_instance;
 		uscp::problem::instance reduced_instance(reduction);
-		reduced_instance.name = reduction.parent_instance->name;
-		reduced_instance.points_number = reduction.parent_instance->points_number
-		                                 - reduction.reduction_applied.points_covered.count();
-		reduced_instance.subsets_number = reduction.parent_instance->subsets_number
-		                                  - reduction.reduction_applied.subsets_dominated.count()
-		                                  - reduction.reduction_applied.subsets_included.count();
+		reduced_instance.name = full_instance.name + " reduced";
+		const size_t reduced_points_number = full_instance.points_number
+		                                     - reduction.reduction_applied.points_covered.count()
+		                                     - reduction.reduction_applied.points_dominated.count();
+		const size_t reduced_subsets_number =
+		  full_instance.subsets_number - reduction.reduction_applied.subsets_dominated.count()
+		  - reduction.reduction_applied.subsets_included.count();
 
-		dynamic_bitset<> removed_subsets = reduction.reduction_applied.subsets_dominated
-		                                   | reduction.reduction_applied.subsets_included;
-		reduced_instance.subsets_points.resize(reduced_instance.subsets_number);
-		size_t i_subset_full_instance = 0;
-		while(removed_subsets[i_subset_full_instance])
+		const dynamic_bitset<> remaining_points = ~(reduction.reduction_applied.points_covered
+		                                            | reduction.reduction_applied.points_dominated);
+		const dynamic_bitset<> remaining_subsets = ~(reduction.reduction_applied.subsets_dominated
+		                                             | reduction.reduction_applied.subsets_included);
+		std::vector<size_t> full_subsets;
+		full_subsets.reserve(reduced_subsets_number);
+		remaining_subsets.iterate_bits_on(
+		  [&](size_t i_subset_full_instance) { full_subsets.push_back(i_subset_full_instance); });
+		if(full_subsets.size() != reduced_subsets_number)
 		{
-			++i_subset_full_instance;
+			LOGGER->error("Solution reduction failed, only {}/{} subsets",
+			              full_subsets.size(),
+			              reduced_subsets_number);
+			abort();
 		}
-		for(size_t i_subset = 0; i_subset < reduced_instance.subsets_number; ++i_subset)
+
+		// Index of each remaining point in the reduced instance, increasing: the rows stay sorted
+		std::vector<uscp::problem::sparse_rows::index_type> reduced_points(
+		  full_instance.points_number, uscp::problem::sparse_rows::MAX_INDEX);
+		uscp::problem::sparse_rows::index_type reduced_point = 0;
+		remaining_points.iterate_bits_on([&](size_t i_point_full_instance) noexcept {
+			reduced_points[i_point_full_instance] = reduced_point++;
+		});
+
+		// Count then fill the remaining points of each remaining subset
+		const bool parallel = reduced_subsets_number > 128;
+		std::vector<uscp::problem::sparse_rows::offset_type> offsets(reduced_subsets_number + 1, 0);
+		// https://gcc.gnu.org/gcc-9/porting_to.html#ompdatasharing
+#if __GNUC__ < 9
+#	pragma omp parallel for default(none) schedule(dynamic, 64) if(parallel) \
+	  shared(offsets, full_instance, full_subsets, reduced_points)
+#else
+#	pragma omp parallel for default(none) schedule(dynamic, 64) if(parallel) \
+	  shared(offsets, full_instance, full_subsets, reduced_points, reduced_subsets_number) \
+	  shared(remaining_points)
+#endif
+		for(/*no size_t for openMP on Windows*/ int i_subset_int = 0;
+		    i_subset_int < static_cast<int>(reduced_subsets_number);
+		    ++i_subset_int)
 		{
-			assert(i_subset_full_instance < reduction.parent_instance->subsets_number);
-			reduced_instance.subsets_points[i_subset].resize(reduced_instance.points_number);
-			size_t i_point_full_instance = 0;
-			while(reduction.reduction_applied.points_covered[i_point_full_instance])
-			{
-				++i_point_full_instance;
-			}
-			for(size_t i_point = 0; i_point < reduced_instance.points_number; ++i_point)
+			const size_t i_subset = static_cast<size_t>(i_subset_int);
+			for(size_t point: full_instance.subsets_points_csr[full_subsets[i_subset]])
 			{
-				assert(i_point_full_instance < reduction.parent_instance->points_number);
-				reduced_instance.subsets_points[i_subset][i_point] =
-				  reduction.parent_instance
-				    ->subsets_points[i_subset_full_instance][i_point_full_instance];
-				do
+				if(remaining_points[point])
 				{
-					++i_point_full_instance;
-				} while(i_point_full_instance < reduction.parent_instance->points_number
-				        && reduction.reduction_applied.points_covered[i_point_full_instance]);
-			}
-			assert(i_point_full_instance == reduction.parent_instance->points_number);
-			if(i_point_full_instance != reduction.parent_instance->points_number)
-			{
-				LOGGER->error("Solution reduction failed, only {}/{} points for subset {}",
-				              i_subset_full_instance,
-				              reduction.parent_instance->subsets_number,
-				              i_subset_full_instance);
-				abort();
+					++offsets[i_subset + 1];
+				}
 			}
-			do
-			{
-				++i_subset_full_instance;
-			} while(i_subset_full_instance < reduction.parent_instance->subsets_number
-			        && removed_subsets[i_subset_full_instance]);
 		}
-		assert(i_subset_full_instance == reduction.parent_instance->subsets_number);
-		if(i_subset_full_instance != reduction.parent_instance->subsets_number)
+		for(size_t i_subset = 0; i_subset < reduced_subsets_number; ++i_subset)
 		{
-			LOGGER->error("Solution reduction failed, only {}/{} subsets",
-			              i_subset_full_instance,
-			              reduction.parent_instance->subsets_number);
-			abort();
+			offsets[i_subset + 1] += offsets[i_subset];
 		}
-		reduced_instance.name += " reduced";
+		std::vector<uscp::problem::sparse_rows::index_type> indexes(offsets.back());
+		// https://gcc.gnu.org/gcc-9/porting_to.html#ompdatasharing
+#if __GNUC__ < 9
+#	pragma omp parallel for default(none) schedule(dynamic, 64) if(parallel) \
+	  shared(offsets, indexes, full_instance, full_subsets, reduced_points)
+#else
+#	pragma omp parallel for default(none) schedule(dynamic, 64) if(parallel) \
+	  shared(offsets, indexes, full_instance, full_subsets, reduced_points) \
+	  shared(reduced_subsets_number, remaining_points)
+#endif
+		for(/*no size_t for openMP on Windows*/ int i_subset_int = 0;
+		    i_subset_int < static_cast<int>(reduced_subsets_number);
+		    ++i_subset_int)
+		{
+			const size_t i_subset = static_cast<size_t>(i_subset_int);
+			uscp::problem::sparse_rows::offset_type position = offsets[i_subset];
+			for(size_t point: full_instance.subsets_points_csr[full_subsets[i_subset]])
+			{
+				if(remaining_points[point])
+				{
+					indexes[position++] = reduced_points[point];
+				}
+			}
+		}
+		uscp::problem::set_subsets_points(
+		  reduced_instance,
+		  reduced_points_number,
+		  uscp::problem::sparse_rows(std::move(offsets), std::move(indexes)),
+		  dense_form);
 
 		SPDLOG_LOGGER_DEBUG(LOGGER,
 		                    "({}) Applied reduction in {}s",
@@ -327,6 +1175,58 @@ namespace
 	}
 } // namespace
 
+uscp::problem::instance uscp::problem::extract(const uscp::problem::instance& full_instance,
+                                               const dynamic_bitset<>& authorized_subsets,
+                                               std::vector<size_t>& subsets_mapping) noexcept
+{
+	assert(authorized_subsets.size() == full_instance.subsets_number);
+
+	subsets_mapping.clear();
+	subsets_mapping.reserve(authorized_subsets.count());
+	authorized_subsets.iterate_bits_on(
+	  [&](size_t i_subset_full_instance) { subsets_mapping.push_back(i_subset_full_instance); });
+
+	// Index + 1 of each covered point in the extracted instance, increasing: the rows stay sorted
+	std::vector<sparse_rows::index_type> extracted_points(full_instance.points_number, 0);
+	std::vector<sparse_rows::offset_type> offsets(subsets_mapping.size() + 1, 0);
+	for(size_t i_subset = 0; i_subset < subsets_mapping.size(); ++i_subset)
+	{
+		const sparse_rows::row_view points =
+		  full_instance.subsets_points_csr[subsets_mapping[i_subset]];
+		offsets[i_subset + 1] = offsets[i_subset] + points.size();
+		for(sparse_rows::index_type point: points)
+		{
+			extracted_points[point] = 1;
+		}
+	}
+	sparse_rows::index_type extracted_points_number = 0;
+	for(sparse_rows::index_type& extracted_point: extracted_points)
+	{
+		if(extracted_point != 0)
+		{
+			extracted_point = ++extracted_points_number;
+		}
+	}
+
+	std::vector<sparse_rows::index_type> indexes;
+	indexes.reserve(offsets.back());
+	for(size_t subset: subsets_mapping)
+	{
+		for(sparse_rows::index_type point: full_instance.subsets_points_csr[subset])
+		{
+			indexes.push_back(extracted_points[point] - 1);
+		}
+	}
+
+	instance extracted_instance;
+	extracted_instance.name = full_instance.name + " extracted";
+	set_subsets_points(extracted_instance,
+	                   extracted_points_number,
+	                   sparse_rows(std::move(offsets), std::move(indexes)),
+	                   false);
+	return extracted_instance;
+}
+
 uscp::problem::instance uscp::problem::reduce(const uscp::problem::instance& full_instance) noexcept
 {
 	assert(!full_instance.reduction.has_value());
@@ -356,108 +1256,210 @@ uscp::problem::instance uscp::problem::reduce(const uscp::problem::instance& ful
 	return reduced_instance;
 }
 
+uscp::problem::instance uscp::problem::reduce_subproblem(
+  const uscp::problem::instance& subproblem_instance) noexcept
+{
+	assert(!subproblem_instance.reduction.has_value());
+	assert(uscp::problem::has_solution(subproblem_instance));
+	return apply_reduction(compute_inclusion_reduction(subproblem_instance), false);
+}
+
 namespace
 {
-	void remove_reduction_cache(const uscp::problem::instance& full_instance) noexcept
+	// Binary reduction cache file, native endianness, made of 64 bits words:
+	// - header: magic, version, instance fingerprint, full points and subsets numbers, reduced
+	// points and subsets numbers, reduced covering number
+	// - reduction bitsets blocks: points covered, points dominated, subsets dominated, subsets
+	// included
+	// - reduced instance sparse rows offsets: subsets points, points subsets
+	// - reduced instance sparse rows indexes (32 bits, padded to a word): subsets points, points
+	// subsets
+	// The reduced instance rows are used in place from the mapped file
+	constexpr uint64_t REDUCTION_CACHE_MAGIC = 0x3144455250435355; // "USCPRED1"
+	constexpr uint64_t REDUCTION_CACHE_VERSION = 3;
+	constexpr size_t REDUCTION_CACHE_HEADER_SIZE = 8;
+
+	[[nodiscard]] size_t blocks_number(size_t bits_number) noexcept
 	{
-		std::filesystem::path reduction_cache_path =
-		  std::string(uscp::problem::REDUCTIONS_CACHE_FOLDER) + full_instance.name + ".json";
-		std::error_code ignored;
-		std::filesystem::remove(reduction_cache_path, ignored);
-		LOGGER->info("({}) removed cache: {}", full_instance.name, reduction_cache_path);
+		constexpr size_t bits_per_block = dynamic_bitset<>::bits_per_block;
+		return (bits_number + bits_per_block - 1) / bits_per_block;
+	}
+
+	std::filesystem::path reduction_cache_path(uint64_t instance_fingerprint) noexcept
+	{
+		return std::string(uscp::problem::REDUCTIONS_CACHE_FOLDER)
+		       + fmt::format("{:016x}.bin", instance_fingerprint);
+	}
+
+	// Copy blocks from the cache to bitset, fail if the padding bits are not reset
+	[[nodiscard]] bool load_blocks(const uscp::block_type*& blocks,
+	                               dynamic_bitset<>& bitset) noexcept
+	{
+		const size_t bitset_blocks = bitset.num_blocks();
+		if(bitset_blocks == 0)
+		{
+			return true;
+		}
+		const size_t padding_bits =
+		  bitset_blocks * dynamic_bitset<>::bits_per_block - bitset.size();
+		if(padding_bits > 0 && (blocks[bitset_blocks - 1] >> (64 - padding_bits)) != 0)
+		{
+			return false;
+		}
+		std::memcpy(bitset.data(), blocks, bitset_blocks * sizeof(uscp::block_type));
+		blocks += bitset_blocks;
+		return true;
+	}
+
+	void write_blocks(std::ostream& stream, const dynamic_bitset<>& bitset) noexcept
+	{
+		stream.write(reinterpret_cast<const char*>(bitset.data()),
+		             static_cast<std::streamsize>(bitset.num_blocks() * sizeof(uscp::block_type)));
 	}
 
-	uscp::problem::reduction_info compute_reduction_cache(
+	std::optional<uscp::problem::instance> load_reduction_cache(
 	  const uscp::problem::instance& full_instance,
-	  bool& from_cache) noexcept
+	  uint64_t instance_fingerprint,
+	  const std::filesystem::path& path) noexcept
 	{
-		std::filesystem::path reduction_cache_path =
-		  std::string(uscp::problem::REDUCTIONS_CACHE_FOLDER) + full_instance.name + ".json";
-		std::error_code ignored;
-		if(std::filesystem::exists(reduction_cache_path, ignored))
+		// shared with the rows of the reduced instance
+		const std::shared_ptr<mapped_file> file = std::make_shared<mapped_file>();
+		if(!file->open(path))
 		{
-			std::ifstream reduction_stream(reduction_cache_path);
-			if(reduction_stream)
-			{
-				nlohmann::json data;
-				reduction_stream >> data;
-				uscp::problem::reduction_serial reduction_serial;
-				bool processed = false;
-				try
-				{
-					data.get_to(reduction_serial);
-					processed = true;
-				}
-				catch(const std::exception& e)
-				{
-					LOGGER->error("({}) error processing cache: {}", full_instance.name, e.what());
-				}
-				catch(...)
-				{
-					LOGGER->error("({}) unknown error processing cache", full_instance.name);
-				}
+			SPDLOG_LOGGER_DEBUG(LOGGER, "({}) {} doesn't exist", full_instance.name, path);
+			return {};
+		}
+		const size_t words_number = file->size() / sizeof(uint64_t);
+		if(file->size() % sizeof(uint64_t) != 0 || words_number < REDUCTION_CACHE_HEADER_SIZE)
+		{
+			LOGGER->error("({}) Invalid cache file {}", full_instance.name, path);
+			return {};
+		}
+		const uint64_t* header = reinterpret_cast<const uint64_t*>(file->data());
+		if(header[0] != REDUCTION_CACHE_MAGIC || header[1] != REDUCTION_CACHE_VERSION
+		   || header[2] != instance_fingerprint || header[3] != full_instance.points_number
+		   || header[4] != full_instance.subsets_number || header[5] > full_instance.points_number
+		   || header[6] > full_instance.subsets_number
+		   || header[7] > full_instance.subsets_points_csr.indexes_number())
+		{
+			LOGGER->error("({}) Cache file {} does not correspond to the instance",
+			              full_instance.name,
+			              path);
+			return {};
+		}
+		const size_t reduced_points_number = header[5];
+		const size_t reduced_subsets_number = header[6];
+		const size_t reduced_covering_number = header[7];
+		const size_t indexes_words_number =
+		  uscp::problem::indexes_words_number(reduced_covering_number);
+		const size_t expected_words_number = REDUCTION_CACHE_HEADER_SIZE
+		                                     + 2 * blocks_number(full_instance.points_number)
+		                                     + 2 * blocks_number(full_instance.subsets_number)
+		                                     + (reduced_subsets_number + 1)
+		                                     + (reduced_points_number + 1)
+		                                     + 2 * indexes_words_number;
+		if(words_number != expected_words_number)
+		{
+			LOGGER->error("({}) Invalid cache file {}", full_instance.name, path);
+			return {};
+		}
 
-				if(processed)
-				{
-					uscp::problem::reduction reduction(full_instance.points_number,
-					                                   full_instance.subsets_number);
-					if(reduction.load(reduction_serial))
-					{
-						LOGGER->info("({}) Loaded reduction from cache {}",
-						             full_instance.name,
-						             reduction_cache_path);
-						if(reduction.subsets_included.size() == full_instance.subsets_number
-						   && reduction.subsets_dominated.size() == full_instance.subsets_number
-						   && reduction.points_covered.size() == full_instance.points_number)
-						{
-							uscp::problem::reduction_info reduction_info(&full_instance);
-							reduction_info.reduction_applied = reduction;
-							from_cache = true;
-							return reduction_info;
-						}
-						LOGGER->info("Loaded reduction does not correspond to the instance");
-					}
-					else
-					{
-						LOGGER->error("({}) Failed to load cache data from {}",
-						              full_instance.name,
-						              reduction_cache_path);
-					}
-				}
-			}
-			else
-			{
-				SPDLOG_LOGGER_DEBUG(LOGGER, "std::ifstream constructor failed");
-				LOGGER->error("Failed to read file {}", reduction_cache_path);
-			}
+		const uscp::block_type* blocks =
+		  reinterpret_cast<const uscp::block_type*>(header + REDUCTION_CACHE_HEADER_SIZE);
+		uscp::problem::reduction_info reduction(&full_instance);
+		uscp::problem::reduction& reduction_applied = reduction.reduction_applied;
+		if(!load_blocks(blocks, reduction_applied.points_covered)
+		   || !load_blocks(blocks, reduction_applied.points_dominated)
+		   || !load_blocks(blocks, reduction_applied.subsets_dominated)
+		   || !load_blocks(blocks, reduction_applied.subsets_included)
+		   || (reduction_applied.points_covered | reduction_applied.points_dominated).count()
+		          + reduced_points_number
+		        != full_instance.points_number
+		   || (reduction_applied.subsets_dominated | reduction_applied.subsets_included).count()
+		          + reduced_subsets_number
+		        != full_instance.subsets_number)
+		{
+			LOGGER->error("({}) Invalid cache file {}", full_instance.name, path);
+			return {};
 		}
-		else
+
+		const auto* subsets_points_offsets =
+		  reinterpret_cast<const uscp::problem::sparse_rows::offset_type*>(blocks);
+		const uscp::problem::sparse_rows::offset_type* points_subsets_offsets =
+		  subsets_points_offsets + reduced_subsets_number + 1;
+		const auto* subsets_points_indexes =
+		  reinterpret_cast<const uscp::problem::sparse_rows::index_type*>(
+		    points_subsets_offsets + reduced_points_number + 1);
+		const auto* points_subsets_indexes =
+		  reinterpret_cast<const uscp::problem::sparse_rows::index_type*>(
+		    reinterpret_cast<const uint64_t*>(subsets_points_indexes)
+		    + indexes_words_number);
+		uscp::problem::sparse_rows subsets_points(
+		  file, subsets_points_offsets, subsets_points_indexes, reduced_subsets_number);
+		uscp::problem::sparse_rows points_subsets(
+		  file, points_subsets_offsets, points_subsets_indexes, reduced_points_number);
+		if(subsets_points.indexes_number() != reduced_covering_number
+		   || points_subsets.indexes_number() != reduced_covering_number
+		   || !uscp::problem::is_valid(subsets_points, reduced_points_number)
+		   || !uscp::problem::is_valid(points_subsets, reduced_subsets_number))
 		{
-			SPDLOG_LOGGER_DEBUG(
-			  LOGGER, "({}) {} doesn't exist", full_instance.name, reduction_cache_path);
+			LOGGER->error("({}) Invalid cache file {}", full_instance.name, path);
+			return {};
 		}
 
-		LOGGER->info("({}) No valid cache for reduction", full_instance.name);
+		uscp::problem::instance reduced_instance(std::move(reduction));
+		reduced_instance.name = full_instance.name + " reduced";
+		uscp::problem::set_subsets_points(reduced_instance,
+		                                  reduced_points_number,
+		                                  std::move(subsets_points),
+		                                  std::move(points_subsets));
 
-		uscp::problem::reduction_info reduction = compute_reduction(full_instance);
-		std::filesystem::create_directories(uscp::problem::REDUCTIONS_CACHE_FOLDER, ignored);
+		LOGGER->info("({}) Loaded reduction from cache {}", full_instance.name, path);
+		return reduced_instance;
+	}
+
+	void save_reduction_cache(const uscp::problem::instance& reduced_instance,
+	                          uint64_t instance_fingerprint,
+	                          const std::filesystem::path& path) noexcept
+	{
+		assert(reduced_instance.reduction.has_value());
+		const uscp::problem::instance& full_instance = *reduced_instance.reduction->parent_instance;
+		const uscp::problem::reduction& reduction_applied =
+		  reduced_instance.reduction->reduction_applied;
 
-		std::ofstream reduction_stream(reduction_cache_path, std::ios::out | std::ios::trunc);
-		if(reduction_stream)
+		std::error_code ignored;
+		std::filesystem::create_directories(uscp::problem::REDUCTIONS_CACHE_FOLDER, ignored);
+		const bool written = write_file_atomically(path, [&](std::ostream& stream) noexcept {
+			const uint64_t header[REDUCTION_CACHE_HEADER_SIZE] = {
+			  REDUCTION_CACHE_MAGIC,
+			  REDUCTION_CACHE_VERSION,
+			  instance_fingerprint,
+			  full_instance.points_number,
+			  full_instance.subsets_number,
+			  reduced_instance.points_number,
+			  reduced_instance.subsets_number,
+			  reduced_instance.subsets_points_csr.indexes_number()};
+			stream.write(reinterpret_cast<const char*>(header), sizeof(header));
+			write_blocks(stream, reduction_applied.points_covered);
+			write_blocks(stream, reduction_applied.points_dominated);
+			write_blocks(stream, reduction_applied.subsets_dominated);
+			write_blocks(stream, reduction_applied.subsets_included);
+			const uscp::problem::sparse_rows& subsets_points = reduced_instance.subsets_points_csr;
+			const uscp::problem::sparse_rows& points_subsets = reduced_instance.points_subsets_csr;
+			uscp::problem::write_offsets(stream, subsets_points);
+			uscp::problem::write_offsets(stream, points_subsets);
+			uscp::problem::write_indexes(stream, subsets_points);
+			uscp::problem::write_indexes(stream, points_subsets);
+			return static_cast<bool>(stream);
+		});
+		if(written)
 		{
-			const nlohmann::json data = reduction.reduction_applied.serialize();
-			reduction_stream << data.dump(4);
-			LOGGER->info("({}) Generated cache {}", full_instance.name, reduction_cache_path);
+			LOGGER->info("({}) Generated cache {}", full_instance.name, path);
 		}
 		else
 		{
-			SPDLOG_LOGGER_DEBUG(LOGGER, "std::ofstream constructor failed");
-			LOGGER->error("Failed to write file {}", reduction_cache_path);
 			LOGGER->error("({}) Failed to generate cache", full_instance.name);
 		}
-
-		from_cache = false;
-		return reduction;
 	}
 } // namespace
 
@@ -473,27 +1475,32 @@ uscp::problem::instance uscp::problem::reduce_cache(
 
 	const timer timer;
 	LOGGER->info("({}) Start reducing instance", full_instance.name);
-	bool from_cache = false;
-	reduction_info reduction = compute_reduction_cache(full_instance, from_cache);
-	instance reduced_instance = apply_reduction(reduction);
-	if(!uscp::problem::has_solution(reduced_instance))
+	const uint64_t instance_fingerprint = full_instance.content_fingerprint;
+	const std::filesystem::path cache_path = reduction_cache_path(instance_fingerprint);
+	std::optional<instance> cached_instance =
+	  load_reduction_cache(full_instance, instance_fingerprint, cache_path);
+	if(cached_instance && !uscp::problem::has_solution(*cached_instance))
 	{
-		if(!from_cache)
-		{
-			LOGGER->error("Reduced instance has no solution");
-			abort();
-		}
 		LOGGER->warn(
 		  "Reduced instance has no solution: erasing reduction cache and generating new one");
-		remove_reduction_cache(full_instance);
-		reduction = compute_reduction_cache(full_instance, from_cache);
-		reduced_instance = apply_reduction(reduction);
-		if(!uscp::problem::has_solution(reduced_instance))
+		std::error_code ignored;
+		std::filesystem::remove(cache_path, ignored);
+		LOGGER->info("({}) removed cache: {}", full_instance.name, cache_path);
+		cached_instance.reset();
+	}
+	if(!cached_instance)
+	{
+		LOGGER->info("({}) No valid cache for reduction", full_instance.name);
+		reduction_info reduction = compute_reduction(full_instance);
+		cached_instance = apply_reduction(reduction);
+		if(!uscp::problem::has_solution(*cached_instance))
 		{
 			LOGGER->error("Reduced instance has no solution");
 			abort();
 		}
+		save_reduction_cache(*cached_instance, instance_fingerprint, cache_path);
 	}
+	instance& reduced_instance = *cached_instance;
 
 	LOGGER->info("({}) Reduced instance from {} subsets {} points to {} subsets {} points in {}s",
 	             full_instance.name,
@@ -502,5 +1509,5 @@ uscp::problem::instance uscp::problem::reduce_cache(
 	             reduced_instance.subsets_number,
 	             reduced_instance.points_number,
 	             timer.elapsed());
-	return reduced_instance;
+	return std::move(reduced_instance);
 }
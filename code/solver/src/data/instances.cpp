@@ -7,15 +7,52 @@
 //
 #include "solver/data/instances.hpp"
 #include "solver/data/instance.hpp"
+#include "common/data/instances/binary.hpp"
 #include "common/utils/logger.hpp"
 
+#include <filesystem>
+#include <system_error>
+
 bool uscp::problem::read(const uscp::problem::instance_info& info,
                          uscp::problem::instance& instance) noexcept
 {
 	instance.name = info.name;
-	if(!info.read_function(info.file, instance))
+	// prefer the converted binary instance, memory-mapped instead of parsed
+	const std::filesystem::path binary_path = uscp::problem::binary::instance_path(info);
+	std::error_code error;
+	bool binary_read = false;
+	if(std::filesystem::is_regular_file(binary_path, error))
 	{
-		return false;
+		if(!uscp::problem::binary::is_up_to_date(binary_path, info.file))
+		{
+			LOGGER->warn("Binary instance {} is outdated, reading {}", binary_path, info.file);
+		}
+		else
+		{
+			binary_read = uscp::problem::binary::read(binary_path, instance);
+			if(!binary_read)
+			{
+				LOGGER->warn(
+				  "Failed to read binary instance {}, reading {}", binary_path, info.file);
+			}
+		}
+	}
+	if(!binary_read)
+	{
+		// Steiner triple systems are built in memory when their file is not downloaded
+		if(info.read_function == &uscp::problem::sts::read
+		   && !std::filesystem::exists(info.file, error))
+		{
+			LOGGER->info("{} not downloaded, generating instance {}", info.file, info.name);
+			if(!uscp::problem::sts::generate(info.subsets, instance))
+			{
+				return false;
+			}
+		}
+		else if(!info.read_function(info.file, instance))
+		{
+			return false;
+		}
 	}
 	if(info.points != instance.points_number)
 	{
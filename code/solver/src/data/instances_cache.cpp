@@ -0,0 +1,228 @@
+//
+// Copyright (c) 2019 Maxime Pinard
+//
+// Distributed under the MIT license
+// See accompanying file LICENSE or copy at
+// https://opensource.org/licenses/MIT
+//
+#include "solver/data/instances_cache.hpp"
+#include "solver/data/instances.hpp"
+#include "solver/data/instance.hpp"
+#include "common/utils/logger.hpp"
+
+#include <cassert>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace
+{
+	struct cache_entry final
+	{
+		std::shared_ptr<const uscp::problem::instance> full_instance;
+		std::shared_ptr<const uscp::problem::instance> reduced_instance;
+		size_t memory = 0;
+		uint64_t last_use = 0;
+	};
+
+	struct cache_state final
+	{
+		std::mutex mutex;
+		std::unordered_map<std::string, uint64_t> names_fingerprint;
+		std::unordered_map<uint64_t, cache_entry> entries;
+		size_t memory = 0;
+		size_t memory_limit = uscp::problem::cache::DEFAULT_MEMORY_LIMIT;
+		uint64_t uses = 0;
+	};
+
+	// Reduced instance with the parent instance it points to
+	struct reduced_holder final
+	{
+		std::shared_ptr<const uscp::problem::instance> parent_instance;
+		uscp::problem::instance reduced_instance;
+	};
+
+	cache_state& state() noexcept
+	{
+		static cache_state state;
+		return state;
+	}
+
+	[[nodiscard]] size_t bitset_memory(const dynamic_bitset<>& bitset) noexcept
+	{
+		return bitset.num_blocks() * sizeof(dynamic_bitset<>::block_type);
+	}
+
+	[[nodiscard]] size_t rows_memory(const uscp::problem::sparse_rows& rows) noexcept
+	{
+		return (rows.rows_number() + 1) * sizeof(uscp::problem::sparse_rows::offset_type)
+		       + rows.indexes_number() * sizeof(uscp::problem::sparse_rows::index_type);
+	}
+
+	[[nodiscard]] size_t instance_memory(const uscp::problem::instance& instance) noexcept
+	{
+		size_t memory =
+		  rows_memory(instance.subsets_points_csr) + rows_memory(instance.points_subsets_csr);
+		for(const dynamic_bitset<>& subset_points: instance.subsets_points)
+		{
+			memory += bitset_memory(subset_points);
+		}
+		if(instance.reduction)
+		{
+			const uscp::problem::reduction& reduction = instance.reduction->reduction_applied;
+			memory += bitset_memory(reduction.points_covered)
+			          + bitset_memory(reduction.points_dominated)
+			          + bitset_memory(reduction.subsets_dominated)
+			          + bitset_memory(reduction.subsets_included);
+		}
+		return memory;
+	}
+
+	void touch(cache_state& cache, cache_entry& entry) noexcept
+	{
+		entry.last_use = ++cache.uses;
+	}
+
+	// Evict least recently used entries other than kept_entry until the limit is respected
+	void evict(cache_state& cache, const cache_entry* kept_entry) noexcept
+	{
+		while(cache.memory > cache.memory_limit)
+		{
+			auto evicted = std::end(cache.entries);
+			for(auto it = std::begin(cache.entries); it != std::end(cache.entries); ++it)
+			{
+				if(&it->second != kept_entry
+				   && (evicted == std::end(cache.entries)
+				       || it->second.last_use < evicted->second.last_use))
+				{
+					evicted = it;
+				}
+			}
+			if(evicted == std::end(cache.entries))
+			{
+				return;
+			}
+
+			LOGGER->info("({}) Evicted instance from cache", evicted->second.full_instance->name);
+			cache.memory -= evicted->second.memory;
+			for(auto it = std::begin(cache.names_fingerprint);
+			    it != std::end(cache.names_fingerprint);)
+			{
+				if(it->second == evicted->first)
+				{
+					it = cache.names_fingerprint.erase(it);
+				}
+				else
+				{
+					++it;
+				}
+			}
+			cache.entries.erase(evicted);
+		}
+	}
+} // namespace
+
+void uscp::problem::cache::set_memory_limit(size_t bytes) noexcept
+{
+	cache_state& cache = state();
+	const std::lock_guard<std::mutex> lock(cache.mutex);
+	cache.memory_limit = bytes;
+	evict(cache, nullptr);
+}
+
+std::shared_ptr<const uscp::problem::instance> uscp::problem::cache::read(
+  const uscp::problem::instance_info& info) noexcept
+{
+	cache_state& cache = state();
+	{
+		const std::lock_guard<std::mutex> lock(cache.mutex);
+		const auto name_it = cache.names_fingerprint.find(std::string(info.name));
+		if(name_it != std::end(cache.names_fingerprint))
+		{
+			cache_entry& entry = cache.entries.at(name_it->second);
+			touch(cache, entry);
+			LOGGER->info("({}) Read instance from cache", info.name);
+			return entry.full_instance;
+		}
+	}
+
+	// read without the lock, the same instance may be read concurrently
+	std::shared_ptr<instance> read_instance = std::make_shared<instance>();
+	if(!uscp::problem::read(info, *read_instance))
+	{
+		return nullptr;
+	}
+
+	const std::lock_guard<std::mutex> lock(cache.mutex);
+	const uint64_t instance_fingerprint = read_instance->content_fingerprint;
+	cache.names_fingerprint[std::string(info.name)] = instance_fingerprint;
+	auto [entry_it, inserted] = cache.entries.try_emplace(instance_fingerprint);
+	cache_entry& entry = entry_it->second;
+	if(inserted)
+	{
+		entry.full_instance = std::move(read_instance);
+		entry.memory = instance_memory(*entry.full_instance);
+		cache.memory += entry.memory;
+	}
+	touch(cache, entry);
+	std::shared_ptr<const instance> full_instance = entry.full_instance;
+	evict(cache, &entry);
+	return full_instance;
+}
+
+std::shared_ptr<const uscp::problem::instance> uscp::problem::cache::reduce(
+  const std::shared_ptr<const uscp::problem::instance>& full_instance) noexcept
+{
+	assert(full_instance);
+	cache_state& cache = state();
+	const uint64_t instance_fingerprint = full_instance->content_fingerprint;
+	std::shared_ptr<const instance> parent_instance;
+	{
+		const std::lock_guard<std::mutex> lock(cache.mutex);
+		auto [entry_it, inserted] = cache.entries.try_emplace(instance_fingerprint);
+		cache_entry& entry = entry_it->second;
+		if(inserted)
+		{
+			entry.full_instance = full_instance;
+			entry.memory = instance_memory(*full_instance);
+			cache.memory += entry.memory;
+		}
+		touch(cache, entry);
+		if(entry.reduced_instance)
+		{
+			LOGGER->info("({}) Reduced instance from cache", full_instance->name);
+			return entry.reduced_instance;
+		}
+		parent_instance = entry.full_instance;
+	}
+
+	// reduce without the lock, the same instance may be reduced concurrently
+	std::shared_ptr<reduced_holder> holder = std::make_shared<reduced_holder>();
+	holder->parent_instance = std::move(parent_instance);
+	holder->reduced_instance = reduce_cache(*holder->parent_instance);
+	std::shared_ptr<const instance> reduced_instance(holder, &holder->reduced_instance);
+
+	const std::lock_guard<std::mutex> lock(cache.mutex);
+	auto [entry_it, inserted] = cache.entries.try_emplace(instance_fingerprint);
+	cache_entry& entry = entry_it->second;
+	if(inserted)
+	{
+		// evicted while reducing
+		entry.full_instance = holder->parent_instance;
+		entry.memory = instance_memory(*entry.full_instance);
+		cache.memory += entry.memory;
+	}
+	if(!entry.reduced_instance)
+	{
+		entry.reduced_instance = reduced_instance;
+		const size_t reduced_memory = instance_memory(*reduced_instance);
+		entry.memory += reduced_memory;
+		cache.memory += reduced_memory;
+	}
+	touch(cache, entry);
+	reduced_instance = entry.reduced_instance;
+	evict(cache, &entry);
+	return reduced_instance;
+}
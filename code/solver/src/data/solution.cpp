@@ -7,6 +7,7 @@
 //
 #include "solver/data/solution.hpp"
 #include "common/utils/logger.hpp"
+#include "common/utils/bits.hpp"
 
 #include <cassert>
 #include <cstddef>
@@ -23,66 +24,35 @@ uscp::solution uscp::expand(const uscp::solution& reduced_solution) noexcept
 	     + reduced_solution.problem.reduction->reduction_applied.subsets_included.count())
 	    != reduced_solution.problem.reduction->parent_instance->subsets_number)
 	   || ((reduced_solution.problem.points_number
-	        + reduced_solution.problem.reduction->reduction_applied.points_covered.count())
+	        + reduced_solution.problem.reduction->reduction_applied.points_covered.count()
+	        + reduced_solution.problem.reduction->reduction_applied.points_dominated.count())
 	       != reduced_solution.problem.reduction->parent_instance->points_number))
 	{
 		LOGGER->error("Tried to expand solution of an invalid reduced instance");
 		abort();
 	}
 
+	const uscp::problem::reduction& reduction = reduced_solution.problem.reduction->reduction_applied;
 	solution expanded_solution(*reduced_solution.problem.reduction->parent_instance);
-	size_t i_expanded = 0;
-	bool passed;
-	do
-	{
-		passed = false;
-		if(reduced_solution.problem.reduction->reduction_applied.subsets_included[i_expanded])
-		{
-			expanded_solution.selected_subsets.set(i_expanded);
-			++i_expanded;
-			passed = true;
-		}
-		else if(reduced_solution.problem.reduction->reduction_applied.subsets_dominated[i_expanded])
-		{
-			++i_expanded;
-			passed = true;
-		}
-	} while(passed);
-	for(size_t i_reduced = 0; i_reduced < reduced_solution.problem.subsets_number; ++i_reduced)
-	{
-		assert(i_expanded < expanded_solution.problem.subsets_number);
-		expanded_solution.selected_subsets[i_expanded] =
-		  reduced_solution.selected_subsets[i_reduced];
-
-		do
-		{
-			++i_expanded;
-			if(i_expanded >= expanded_solution.problem.subsets_number)
-			{
-				break;
-			}
-			passed = false;
-			if(reduced_solution.problem.reduction->reduction_applied.subsets_included[i_expanded])
-			{
-				expanded_solution.selected_subsets.set(i_expanded);
-				passed = true;
-			}
-			else if(reduced_solution.problem.reduction->reduction_applied
-			          .subsets_dominated[i_expanded])
-			{
-				passed = true;
-			}
-		} while(passed);
-	}
-	assert(i_expanded == expanded_solution.problem.subsets_number);
-	if(i_expanded != expanded_solution.problem.subsets_number)
-	{
-		LOGGER->error("Solution expansion failed, only {}/{} subsets",
-		              i_expanded,
-		              expanded_solution.problem.subsets_number);
-		abort();
-	}
+	const dynamic_bitset<> remaining_subsets =
+	  ~(reduction.subsets_dominated | reduction.subsets_included);
+	expand_bits(reduced_solution.selected_subsets,
+	            remaining_subsets,
+	            expanded_solution.selected_subsets);
+	expanded_solution.selected_subsets |= reduction.subsets_included;
 
 	expanded_solution.compute_cover();
 	return expanded_solution;
 }
+
+void uscp::expand(const uscp::solution& extracted_solution,
+                  const std::vector<size_t>& subsets_mapping,
+                  uscp::solution& full_solution) noexcept
+{
+	assert(extracted_solution.selected_subsets.size() == subsets_mapping.size());
+	full_solution.selected_subsets.reset();
+	extracted_solution.selected_subsets.iterate_bits_on([&](size_t i_subset) noexcept {
+		full_solution.selected_subsets.set(subsets_mapping[i_subset]);
+	});
+	full_solution.compute_cover();
+}
@@ -9,6 +9,7 @@
 #include "solver/algorithms/greedy.hpp"
 #include "solver/algorithms/rwls.hpp"
 #include "solver/algorithms/memetic.hpp"
+#include "solver/algorithms/redundancy.hpp"
 #include "solver/algorithms/crossovers/identity.hpp"
 #include "solver/algorithms/crossovers/merge.hpp"
 #include "solver/algorithms/crossovers/greedy_merge.hpp"
@@ -29,6 +30,7 @@
 #include "solver/algorithms/wcrossover/minmax.hpp"
 #include "solver/algorithms/wcrossover/shuffle.hpp"
 #include "solver/data/instances.hpp"
+#include "solver/data/instances_cache.hpp"
 #include "common/utils/logger.hpp"
 #include "common/utils/random.hpp"
 #include "common/data/instance.hpp"
@@ -40,8 +42,11 @@
 #include <nlohmann/json.hpp>
 
 #include <cstdlib>
+#include <cstdint>
+#include <algorithm>
 #include <vector>
 #include <limits>
+#include <memory>
 #include <sstream>
 #include <fstream>
 #include <iomanip>
@@ -64,9 +69,31 @@ namespace
 		std::string instance_path;
 		std::string instance_name;
 
+		// generated Steiner triple system instance
+		size_t sts_order = 0;
+
+		// convert the instances to the binary format instead of solving them
+		bool convert = false;
+
+		// generate a random instance to a binary file (instance_path) instead of solving
+		bool generate = false;
+		size_t generate_points = 0;
+		size_t generate_subsets = 0;
+		size_t generate_min_covering = 2;
+		size_t generate_max_covering = 0; // subsets number if 0 (Balas and Ho)
+		uint64_t generate_seed = 0;
+
 		// general options
 		std::string output_prefix = "solver_out_";
 		size_t repetitions = 1;
+		uint64_t seed = 0;
+		bool random_seed = true; // seed drawn from std::random_device if not specified
+		bool prune = false;
+		std::string prune_order_name = "largest";
+		uscp::redundancy::order prune_order = uscp::redundancy::order::largest;
+		size_t target = 0;       // stop RWLS and memetic at this number of subsets, 0 for none
+		bool target_bks = false; // target the best known solution of registered instances
+		size_t instances_cache = uscp::problem::cache::DEFAULT_MEMORY_LIMIT >> 20; // MiB
 
 		// greedy options
 		bool greedy = false;
@@ -177,29 +204,61 @@ namespace
 		  std::forward<Lambda>(lambda), all_crossovers{}, all_wcrossovers{});
 	}
 
-	std::optional<nlohmann::json> process_instance(program_options& program_options,
-	                                               uscp::random_engine& generator,
-	                                               const uscp::problem::instance& instance_base,
-	                                               bool reduce) noexcept
+	template<typename Crossovers, typename WCrossovers>
+	struct adaptive_memetic;
+
+	// Memetic with all the crossovers and wcrossovers, the pair of each child selected at runtime
+	template<typename... Crossovers, typename... WCrossovers>
+	struct adaptive_memetic<crossovers<Crossovers...>, wcrossovers<WCrossovers...>>
+	{
+		typedef uscp::memetic::memetic<uscp::memetic::operators<Crossovers...>,
+		                               uscp::memetic::operators<WCrossovers...>>
+		  type;
+	};
+
+	std::optional<nlohmann::json> process_instance(
+	  program_options& program_options,
+	  uscp::random_engine& generator,
+	  const std::shared_ptr<const uscp::problem::instance>& instance_base_ptr,
+	  bool reduce,
+	  size_t bks = 0) noexcept
 	{
+		const uscp::problem::instance& instance_base = *instance_base_ptr;
 		if(!uscp::problem::has_solution(instance_base))
 		{
 			LOGGER->error("Instance {} have no solution", instance_base.name);
 			return {};
 		}
 
-		uscp::problem::instance instance;
-		if(reduce)
+		const std::shared_ptr<const uscp::problem::instance> instance_ptr =
+		  reduce ? uscp::problem::cache::reduce(instance_base_ptr) : instance_base_ptr;
+		const uscp::problem::instance& instance = *instance_ptr;
+
+		nlohmann::json data_instance;
+		data_instance["instance"] = instance_base.serialize();
+
+		// Stopping target, relative to the solved instance: the subsets included by the reduction
+		// are part of every expanded solution, reports record the requested target
+		size_t target = program_options.target;
+		if(program_options.target_bks && bks > 0)
 		{
-			instance = uscp::problem::reduce_cache(instance_base);
+			target = std::max(target, bks);
 		}
-		else
+		size_t solved_target = target;
+		if(target != 0)
 		{
-			instance = instance_base;
+			LOGGER->info("({}) Stop as soon as a solution with at most {} subsets is found",
+			             instance_base.name,
+			             target);
+			data_instance["target"] = target;
+			if(reduce)
+			{
+				const size_t included_subsets =
+				  instance.reduction->reduction_applied.subsets_included.count();
+				// 0 if unreachable: every solution has more subsets than the target
+				solved_target = target > included_subsets ? target - included_subsets : 0;
+			}
 		}
-
-		nlohmann::json data_instance;
-		data_instance["instance"] = instance_base.serialize();
 		if(program_options.greedy && !program_options.rwls)
 		{
 			uscp::greedy::report greedy_report = uscp::greedy::solve_report(instance);
@@ -257,16 +316,26 @@ namespace
 					data_instance["greedy"] = greedy_report.serialize();
 				}
 			}
+			uscp::solution rwls_initial_solution = greedy_report.solution_final;
+			if(program_options.prune)
+			{
+				const size_t pruned_subsets = uscp::redundancy::prune(
+				  program_options.prune_order, generator, rwls_initial_solution);
+				LOGGER->info("({}) Pruned {} redundant subsets from greedy solution",
+				             instance_base.name,
+				             pruned_subsets);
+			}
 			std::vector<nlohmann::json> data_rwls;
 			uscp::rwls::rwls rwls_manager(instance);
-			rwls_manager.initialize();
+			rwls_manager.set_target(solved_target);
 			for(size_t repetition = 0; repetition < program_options.repetitions; ++repetition)
 			{
-				uscp::rwls::report rwls_report = rwls_manager.improve(
-				  greedy_report.solution_final, generator, program_options.rwls_stop);
+				uscp::rwls::report rwls_report =
+				  rwls_manager.improve(rwls_initial_solution, generator, program_options.rwls_stop);
 				if(reduce)
 				{
 					uscp::rwls::report expanded_rwls_report = uscp::rwls::expand(rwls_report);
+					expanded_rwls_report.target = target;
 					if(!expanded_rwls_report.solution_final.cover_all_points)
 					{
 						LOGGER->error("Expanded rwls solution doesn't cover all points");
@@ -294,17 +363,19 @@ namespace
 		}
 		if(program_options.memetic)
 		{
+			uscp::memetic::config memetic_config = program_options.memetic_config;
+			memetic_config.target = solved_target;
 			auto process_memetic = [&](auto memetic_alg) -> bool {
 				std::vector<nlohmann::json> data_memetic;
-				memetic_alg.initialize();
 				for(size_t repetition = 0; repetition < program_options.repetitions; ++repetition)
 				{
 					uscp::memetic::report memetic_report =
-					  memetic_alg.solve(generator, program_options.memetic_config);
+					  memetic_alg.solve(generator, memetic_config);
 					if(reduce)
 					{
 						uscp::memetic::report expanded_memetic_report =
 						  uscp::memetic::expand(memetic_report);
+						expanded_memetic_report.solve_config.target = target;
 						if(!expanded_memetic_report.solution_final.cover_all_points)
 						{
 							LOGGER->error("Expanded memetic solution doesn't cover all points");
@@ -332,44 +403,63 @@ namespace
 				return true;
 			};
 
-			bool found_crossover = false;
-			bool found_wcrossover = false;
-			bool success = false;
-			forall_crossover_wcrossover([&](auto crossover, auto wcrossover) noexcept {
-				typedef typename decltype(crossover)::type crossover_type;
-				typedef typename decltype(wcrossover)::type wcrossover_type;
-				if(program_options.memetic_crossover == crossover_type::to_string())
+			const std::string_view adaptive = uscp::memetic::operators<>::to_string();
+			if(program_options.memetic_crossover == adaptive
+			   || program_options.memetic_wcrossover == adaptive)
+			{
+				if(program_options.memetic_crossover != program_options.memetic_wcrossover)
 				{
-					found_crossover = true;
-					if(program_options.memetic_wcrossover == wcrossover_type::to_string())
+					LOGGER->error("Adaptive operators need both crossover and wcrossover to be {}",
+					              adaptive);
+					return {};
+				}
+				adaptive_memetic<all_crossovers, all_wcrossovers>::type memetic_alg_(instance);
+				if(!process_memetic(memetic_alg_))
+				{
+					return {};
+				}
+			}
+			else
+			{
+				bool found_crossover = false;
+				bool found_wcrossover = false;
+				bool success = false;
+				forall_crossover_wcrossover([&](auto crossover, auto wcrossover) noexcept {
+					typedef typename decltype(crossover)::type crossover_type;
+					typedef typename decltype(wcrossover)::type wcrossover_type;
+					if(program_options.memetic_crossover == crossover_type::to_string())
 					{
-						found_wcrossover = true;
-						uscp::memetic::memetic<crossover_type, wcrossover_type> memetic_alg_(
-						  instance);
-						if(process_memetic(memetic_alg_))
+						found_crossover = true;
+						if(program_options.memetic_wcrossover == wcrossover_type::to_string())
 						{
-							success = true;
+							found_wcrossover = true;
+							uscp::memetic::memetic<crossover_type, wcrossover_type> memetic_alg_(
+							  instance);
+							if(process_memetic(memetic_alg_))
+							{
+								success = true;
+							}
+							return false;
 						}
-						return false;
 					}
+					return true;
+				});
+				if(!found_crossover)
+				{
+					LOGGER->error("No crossover operator named \"{}\" exist",
+					              program_options.memetic_crossover);
+					return {};
+				}
+				if(!found_wcrossover)
+				{
+					LOGGER->error("No RWLS weights crossover operator named \"{}\" exist",
+					              program_options.memetic_wcrossover);
+					return {};
+				}
+				if(!success)
+				{
+					return {};
 				}
-				return true;
-			});
-			if(!found_crossover)
-			{
-				LOGGER->error("No crossover operator named \"{}\" exist",
-				              program_options.memetic_crossover);
-				return {};
-			}
-			if(!found_wcrossover)
-			{
-				LOGGER->error("No RWLS weights crossover operator named \"{}\" exist",
-				              program_options.memetic_wcrossover);
-				return {};
-			}
-			if(!success)
-			{
-				return {};
 			}
 		}
 
@@ -396,20 +486,25 @@ namespace
 			}
 			LOGGER->info("Current instance information: {}", *instance_it);
 
-			uscp::problem::instance instance_base;
-			if(!uscp::problem::read(*instance_it, instance_base))
+			const std::shared_ptr<const uscp::problem::instance> instance_base =
+			  uscp::problem::cache::read(*instance_it);
+			if(!instance_base)
 			{
 				LOGGER->error("Failed to read instance {}", *instance_it);
 				return {};
 			}
-			if(!uscp::problem::has_solution(instance_base))
+			if(!uscp::problem::has_solution(*instance_base))
 			{
-				LOGGER->error("Instance {} have no solution", instance_base.name);
+				LOGGER->error("Instance {} have no solution", instance_base->name);
 				return {};
 			}
 
 			std::optional<nlohmann::json> data_instance =
-			  process_instance(program_options, generator, instance_base, instance_it->can_reduce);
+			  process_instance(program_options,
+			                   generator,
+			                   instance_base,
+			                   instance_it->can_reduce,
+			                   instance_it->bks);
 			if(!data_instance)
 			{
 				return {};
@@ -448,9 +543,10 @@ namespace
 		}
 		const uscp::problem::problem_reader& problem_reader = *it;
 
-		uscp::problem::instance instance_base;
-		instance_base.name = program_options.instance_name;
-		if(!problem_reader.function(program_options.instance_path, instance_base))
+		std::shared_ptr<uscp::problem::instance> instance_base =
+		  std::make_shared<uscp::problem::instance>();
+		instance_base->name = program_options.instance_name;
+		if(!problem_reader.function(program_options.instance_path, *instance_base))
 		{
 			LOGGER->error("Failed to read {} instance {} ({})",
 			              program_options.instance_type,
@@ -458,14 +554,144 @@ namespace
 			              program_options.instance_path);
 			return {};
 		}
-		if(!uscp::problem::has_solution(instance_base))
+		if(!uscp::problem::has_solution(*instance_base))
 		{
-			LOGGER->error("Instance {} have no solution", instance_base.name);
+			LOGGER->error("Instance {} have no solution", instance_base->name);
 			return {};
 		}
 
 		return process_instance(program_options, generator, instance_base, true);
 	}
+
+	std::optional<nlohmann::json> process_generated_sts(program_options& program_options,
+	                                                    uscp::random_engine& generator) noexcept
+	{
+		std::shared_ptr<uscp::problem::instance> instance_base =
+		  std::make_shared<uscp::problem::instance>();
+		instance_base->name = "STS" + std::to_string(program_options.sts_order);
+		if(!uscp::problem::sts::generate(program_options.sts_order, *instance_base))
+		{
+			LOGGER->error("Failed to generate instance {}", instance_base->name);
+			return {};
+		}
+
+		// like the registered STS instances, nothing to reduce
+		return process_instance(program_options, generator, instance_base, false);
+	}
+
+	bool convert_instances(const program_options& program_options) noexcept
+	{
+		if(!program_options.instances.empty())
+		{
+			std::error_code error;
+			std::filesystem::create_directories(BINARY_INSTANCES_FOLDER, error);
+			if(error)
+			{
+				SPDLOG_LOGGER_DEBUG(
+				  LOGGER, "std::filesystem::create_directories failed: {}", error.message());
+			}
+		}
+		for(const std::string& instance_name: program_options.instances)
+		{
+			const auto instance_it =
+			  std::find_if(std::cbegin(uscp::problem::instances),
+			               std::cend(uscp::problem::instances),
+			               [&](const uscp::problem::instance_info& instance_info) {
+				               return instance_info.name == instance_name;
+			               });
+			if(instance_it == std::cend(uscp::problem::instances))
+			{
+				LOGGER->error("No known instance named {} exist", instance_name);
+				return false;
+			}
+
+			// always from the original file, the binary one may be outdated
+			uscp::problem::instance instance;
+			instance.name = instance_it->name;
+			if(!instance_it->read_function(instance_it->file, instance))
+			{
+				LOGGER->error("Failed to read instance {}", *instance_it);
+				return false;
+			}
+			const std::filesystem::path binary_path =
+			  uscp::problem::binary::instance_path(*instance_it);
+			if(!uscp::problem::binary::write(instance, binary_path, true, instance_it->file))
+			{
+				LOGGER->error("Failed to convert instance {}", *instance_it);
+				return false;
+			}
+			LOGGER->info("Converted instance {} to {}", instance.name, binary_path);
+		}
+
+		if(!program_options.instance_type.empty() || !program_options.instance_path.empty())
+		{
+			auto it = std::find_if(std::cbegin(uscp::problem::readers),
+			                       std::cend(uscp::problem::readers),
+			                       [&](const uscp::problem::problem_reader& problem_reader) {
+				                       return problem_reader.name == program_options.instance_type;
+			                       });
+			if(it == std::cend(uscp::problem::readers))
+			{
+				LOGGER->error("Invalid instance type: {}", program_options.instance_type);
+				return false;
+			}
+			uscp::problem::instance instance;
+			instance.name = program_options.instance_name;
+			if(!it->function(program_options.instance_path, instance))
+			{
+				LOGGER->error("Failed to read {} instance {}",
+				              program_options.instance_type,
+				              program_options.instance_path);
+				return false;
+			}
+			const std::filesystem::path binary_path = program_options.instance_path + ".bin";
+			if(!uscp::problem::binary::write(
+			     instance, binary_path, true, program_options.instance_path))
+			{
+				LOGGER->error("Failed to convert instance {}", program_options.instance_path);
+				return false;
+			}
+			LOGGER->info("Converted instance {} to {}", program_options.instance_path, binary_path);
+		}
+		return true;
+	}
+
+	bool generate_instance(const program_options& program_options) noexcept
+	{
+		if(program_options.instance_path.empty())
+		{
+			LOGGER->error("No instance path given for the generated instance");
+			return false;
+		}
+		const size_t max_covering = program_options.generate_max_covering == 0
+		                              ? program_options.generate_subsets
+		                              : program_options.generate_max_covering;
+		if(program_options.generate_points == 0 || program_options.generate_subsets == 0
+		   || program_options.generate_points > uscp::problem::sparse_rows::MAX_INDEX
+		   || program_options.generate_subsets > uscp::problem::sparse_rows::MAX_INDEX)
+		{
+			LOGGER->error("Invalid generated instance size: {} points, {} subsets",
+			              program_options.generate_points,
+			              program_options.generate_subsets);
+			return false;
+		}
+		if(program_options.generate_min_covering == 0
+		   || program_options.generate_min_covering > max_covering
+		   || max_covering > program_options.generate_subsets)
+		{
+			LOGGER->error("Invalid generated instance covering subsets: {} to {}",
+			              program_options.generate_min_covering,
+			              max_covering);
+			return false;
+		}
+		return uscp::problem::generate_binary(program_options.instance_path,
+		                                      program_options.generate_points,
+		                                      program_options.generate_subsets,
+		                                      program_options.generate_seed,
+		                                      program_options.generate_min_covering,
+		                                      max_covering,
+		                                      true);
+	}
 } // namespace
 
 int main(int argc, char* argv[])
@@ -482,6 +708,17 @@ int main(int argc, char* argv[])
 	const std::string valid_instance_types = instance_types_stream.str();
 	const std::string default_output_prefix = "solver_out_";
 	const std::string default_repetitions = "1";
+	const std::string default_convert = "false";
+	const std::string default_generate = "false";
+	const std::string default_generate_min_covering = "2";
+	const std::string default_generate_max_covering = "0";
+	const std::string default_generate_seed = "0";
+	const std::string default_prune = "false";
+	const std::string default_prune_order = "largest";
+	const std::string default_target = "0";
+	const std::string default_target_bks = "false";
+	const std::string default_instances_cache =
+	  std::to_string(uscp::problem::cache::DEFAULT_MEMORY_LIMIT >> 20);
 	const std::string default_greedy = "false";
 	const std::string default_rwls = "false";
 	const std::string default_rwls_steps = std::to_string(std::numeric_limits<size_t>::max());
@@ -492,6 +729,12 @@ int main(int argc, char* argv[])
 	const std::string default_memetic_cumulative_rwls_time =
 	  std::to_string(std::numeric_limits<size_t>::max());
 	const std::string default_memetic_time = std::to_string(std::numeric_limits<size_t>::max());
+	const std::string default_memetic_population = "2";
+	const std::string default_memetic_islands = "1";
+	const std::string default_memetic_migration = "10";
+	const std::string default_memetic_steady_state = "false";
+	const std::string default_memetic_outcomes =
+	  std::to_string(uscp::memetic::config{}.outcomes_table_size);
 	const std::string default_memetic_crossover = "default";
 	const std::string default_memetic_wcrossover = "default";
 
@@ -512,19 +755,37 @@ int main(int argc, char* argv[])
 		     "To specify the algorithm to use and the parameters of the algorithm, see the Usage section\n"
 		     "\n"
 		     "To specify known instances, use --instances=<comma separated list of instances>\n"
-		     "To specify an unknown instances, use --instance_type=<orlibrary|orlibrary_rail|sts|gvcp> --instance_path=<path> --instance_name=<name>\n"
+		     "To specify an unknown instances, use --instance_type=<orlibrary|orlibrary_rail|sts|gvcp|binary> --instance_path=<path> --instance_name=<name>\n"
+		     "To generate a Steiner triple system instance of order 6n+3, use --sts=<order>\n"
+		     "To reproduce a run, use --seed=<seed> with the seed saved in its output file\n"
 		     "\n"
 		     "Known instances: 4.1,4.2,4.3,4.4,4.5,4.6,4.7,4.8,4.9,4.10,5.1,5.2,5.3,5.4,5.5,5.6,5.7,5.8,5.9,5.10,6.1,6.2,6.3,6.4,6.5,A.1,A.2,A.3,A.4,A.5,B.1,B.2,B.3,B.4,B.5,C.1,C.2,C.3,C.4,C.5,D.1,D.2,D.3,D.4,D.5,E.1,E.2,E.3,E.4,E.5,NRE.1,NRE.2,NRE.3,NRE.4,NRE.5,NRF.1,NRF.2,NRF.3,NRF.4,NRF.5,NRG.1,NRG.2,NRG.3,NRG.4,NRG.5,NRH.1,NRH.2,NRH.3,NRH.4,NRH.5,CLR10,CLR11,CLR12,CLR13,CYC6,CYC7,CYC8,CYC9,CYC10,CYC11,RAIL507,RAIL516,RAIL582,RAIL2536,RAIL2586,RAIL4284,RAIL4872,STS9,STS15,STS27,STS45,STS81,STS135,STS243,STS405,STS729,STS1215,STS2187\n"
 		     "\n"
 		     "Implemented crossovers: identity, merge, greedy_merge, subproblem_random, extended_subproblem_random, subproblem_greedy, extended_subproblem_greedy, subproblem_rwls, extended_subproblem_rwls\n"
 		     "Implemented wcrossovers: reset, keep, average, mix_random, add, difference, max, min, minmax, shuffle\n"
+		     "With both operators set to adaptive, the pair of each memetic child is selected at runtime among all the crossovers and wcrossovers\n"
 		     "\n"
 		     "Usage examples:\n"
 		     "  Solve CYC10 and CYC11 instances with RWLS and a limit of 5000 steps:\n"
 		     "    ./solver --instances=CYC10,CYC11 --rwls --rwls_steps=5000\n"
 		     "\n"
 		     "  Solve R42, an unknown RAIL instance in ./rail_42.txt using the same format as in OR-Library, with the Memetic algorithm, the subproblem_rwls crossover, the max wcrossover and a limit of 360 seconds:\n"
-		     "    ./solver --instance_type=orlibrary_rail --instance_path=./rail_42.txt --instance_name=R42 --memetic --memetic_crossover=subproblem_rwls --memetic_wcrossover=max --memetic_time=360\n";
+		     "    ./solver --instance_type=orlibrary_rail --instance_path=./rail_42.txt --instance_name=R42 --memetic --memetic_crossover=subproblem_rwls --memetic_wcrossover=max --memetic_time=360\n"
+		     "\n"
+		     "  Solve RAIL4284 with the Memetic algorithm on 8 islands of 4 individuals, exchanging their elites every 5 generations:\n"
+		     "    ./solver --instances=RAIL4284 --memetic --memetic_islands=8 --memetic_population=4 --memetic_migration=5\n"
+		     "\n"
+		     "  Solve RAIL4284 with the Memetic algorithm, selecting the best performing crossover and wcrossover pairs during the resolution:\n"
+		     "    ./solver --instances=RAIL4284 --memetic --memetic_crossover=adaptive --memetic_wcrossover=adaptive\n"
+		     "\n"
+		     "  Solve CYC10 and CYC11 with RWLS, stopping as soon as their best known solutions are reached:\n"
+		     "    ./solver --instances=CYC10,CYC11 --rwls --target_bks\n"
+		     "\n"
+		     "  Convert CYC10 to the binary format, in " BINARY_INSTANCES_FOLDER ", read instead of the original file afterward:\n"
+		     "    ./solver --instances=CYC10 --convert\n"
+		     "\n"
+		     "  Generate a random instance with 1000000 points and 100000 subsets, each point covered by 2 to 20 subsets, to ./random.bin:\n"
+		     "    ./solver --generate --generate_points=1000000 --generate_subsets=100000 --generate_max_covering=20 --instance_path=./random.bin\n";
 		cxxopts::Options options("solver", help_txt.str());
 		options.add_option("", cxxopts::Option("help", "Print help"));
 		options.add_option("", cxxopts::Option("version", "Print version"));
@@ -552,6 +813,55 @@ int main(int argc, char* argv[])
 		                  "Name of the instance to process",
 		                  cxxopts::value<std::string>(program_options.instance_name),
 		                  "NAME"));
+		options.add_option(
+		  "",
+		  cxxopts::Option("sts",
+		                  "Order of a Steiner triple system instance to generate and process",
+		                  cxxopts::value<size_t>(program_options.sts_order),
+		                  "N"));
+		options.add_option(
+		  "",
+		  cxxopts::Option(
+		    "convert",
+		    "Convert the instances to the binary format instead of solving them",
+		    cxxopts::value<bool>(program_options.convert)->default_value(default_convert)));
+		options.add_option(
+		  "",
+		  cxxopts::Option(
+		    "generate",
+		    "Generate a random instance to the binary format in instance_path instead of solving",
+		    cxxopts::value<bool>(program_options.generate)->default_value(default_generate)));
+		options.add_option("",
+		                   cxxopts::Option("generate_points",
+		                                   "Generated instance points number",
+		                                   cxxopts::value<size_t>(program_options.generate_points),
+		                                   "N"));
+		options.add_option("",
+		                   cxxopts::Option("generate_subsets",
+		                                   "Generated instance subsets number",
+		                                   cxxopts::value<size_t>(program_options.generate_subsets),
+		                                   "N"));
+		options.add_option(
+		  "",
+		  cxxopts::Option("generate_min_covering",
+		                  "Generated instance minimum subsets covering a point",
+		                  cxxopts::value<size_t>(program_options.generate_min_covering)
+		                    ->default_value(default_generate_min_covering),
+		                  "N"));
+		options.add_option(
+		  "",
+		  cxxopts::Option(
+		    "generate_max_covering",
+		    "Generated instance maximum subsets covering a point (0 for the subsets number)",
+		    cxxopts::value<size_t>(program_options.generate_max_covering)
+		      ->default_value(default_generate_max_covering),
+		    "N"));
+		options.add_option("",
+		                   cxxopts::Option("generate_seed",
+		                                   "Generated instance random seed",
+		                                   cxxopts::value<uint64_t>(program_options.generate_seed)
+		                                     ->default_value(default_generate_seed),
+		                                   "N"));
 		options.add_option(
 		  "",
 		  cxxopts::Option("o,output_prefix",
@@ -566,6 +876,44 @@ int main(int argc, char* argv[])
 		    "Repetitions number",
 		    cxxopts::value<size_t>(program_options.repetitions)->default_value(default_repetitions),
 		    "N"));
+		options.add_option(
+		  "",
+		  cxxopts::Option("seed",
+		                  "Seed of the random generators (random if not specified)",
+		                  cxxopts::value<uint64_t>(program_options.seed),
+		                  "N"));
+		options.add_option(
+		  "",
+		  cxxopts::Option(
+		    "prune",
+		    "Remove redundant subsets from the solutions given to RWLS",
+		    cxxopts::value<bool>(program_options.prune)->default_value(default_prune)));
+		options.add_option(
+		  "",
+		  cxxopts::Option("prune_order",
+		                  "Order of the subsets considered by --prune: largest|random",
+		                  cxxopts::value<std::string>(program_options.prune_order_name)
+		                    ->default_value(default_prune_order),
+		                  "ORDER"));
+		options.add_option(
+		  "",
+		  cxxopts::Option(
+		    "target",
+		    "Stop RWLS and memetic as soon as a solution with at most N subsets is found (0: none)",
+		    cxxopts::value<size_t>(program_options.target)->default_value(default_target),
+		    "N"));
+		options.add_option(
+		  "",
+		  cxxopts::Option(
+		    "target_bks",
+		    "Stop RWLS and memetic as soon as the best known solution of the instance is reached",
+		    cxxopts::value<bool>(program_options.target_bks)->default_value(default_target_bks)));
+		options.add_option("",
+		                   cxxopts::Option("instances_cache",
+		                                   "Memory limit (MiB) of the instances kept between runs",
+		                                   cxxopts::value<size_t>(program_options.instances_cache)
+		                                     ->default_value(default_instances_cache),
+		                                   "N"));
 
 		// Greedy
 		options.add_option(
@@ -626,21 +974,65 @@ int main(int argc, char* argv[])
 		                                     program_options.memetic_config.stopping_criterion.time)
 		                                     ->default_value(default_memetic_time),
 		                                   "N"));
+		options.add_option(
+		  "",
+		  cxxopts::Option("memetic_population",
+		                  "Memetic population size of each island (rounded up to an even number)",
+		                  cxxopts::value<size_t>(program_options.memetic_config.population_size)
+		                    ->default_value(default_memetic_population),
+		                  "N"));
+		options.add_option(
+		  "",
+		  cxxopts::Option("memetic_islands",
+		                  "Memetic islands number (0: one island per population_size hardware threads)",
+		                  cxxopts::value<size_t>(program_options.memetic_config.islands)
+		                    ->default_value(default_memetic_islands),
+		                  "N"));
+		options.add_option(
+		  "",
+		  cxxopts::Option("memetic_migration",
+		                  "Memetic generations between two migrations of the islands elites",
+		                  cxxopts::value<size_t>(program_options.memetic_config.migration_interval)
+		                    ->default_value(default_memetic_migration),
+		                  "N"));
+		options.add_option(
+		  "",
+		  cxxopts::Option("memetic_steady_state",
+		                  "Memetic without generations: threads create children asynchronously",
+		                  cxxopts::value<bool>(program_options.memetic_config.steady_state)
+		                    ->default_value(default_memetic_steady_state)));
+		options.add_option(
+		  "",
+		  cxxopts::Option("memetic_outcomes",
+		                  "Memetic RWLS outcomes kept to resume duplicate children (0: none)",
+		                  cxxopts::value<size_t>(program_options.memetic_config.outcomes_table_size)
+		                    ->default_value(default_memetic_outcomes),
+		                  "N"));
 		options.add_option(
 		  "",
 		  cxxopts::Option("memetic_crossover",
-		                  "Memetic crossover operator",
+		                  "Memetic crossover operator (adaptive: selected at runtime)",
 		                  cxxopts::value<std::string>(program_options.memetic_crossover)
 		                    ->default_value(default_memetic_crossover),
 		                  "OPERATOR"));
 		options.add_option(
 		  "",
 		  cxxopts::Option("memetic_wcrossover",
-		                  "Memetic RWLS weights crossover operator",
+		                  "Memetic RWLS weights crossover operator (adaptive: selected at runtime)",
 		                  cxxopts::value<std::string>(program_options.memetic_wcrossover)
 		                    ->default_value(default_memetic_wcrossover),
 		                  "OPERATOR"));
 		cxxopts::ParseResult result = options.parse(argc, argv);
+		program_options.memetic_config.prune_redundant = program_options.prune;
+		if(!uscp::redundancy::from_string(program_options.prune_order_name,
+		                                  program_options.prune_order))
+		{
+			std::cout << "error parsing options: invalid prune order: "
+			          << program_options.prune_order_name << std::endl;
+			return EXIT_FAILURE;
+		}
+		program_options.memetic_config.prune_order = program_options.prune_order;
+		program_options.random_seed = result.count("seed") == 0;
 
 		if(result.count("help"))
 		{
@@ -660,13 +1052,15 @@ int main(int argc, char* argv[])
 		}
 
 		if(program_options.instances.empty() && program_options.instance_type.empty()
-		   && program_options.instance_path.empty() && program_options.instance_name.empty())
+		   && program_options.instance_path.empty() && program_options.instance_name.empty()
+		   && program_options.sts_order == 0 && !program_options.generate)
 		{
 			std::cout << "No instances specified, nothing to do" << std::endl;
 			return EXIT_SUCCESS;
 		}
 
-		if(!program_options.greedy && !program_options.rwls && !program_options.memetic)
+		if(!program_options.convert && !program_options.generate && !program_options.greedy
+		   && !program_options.rwls && !program_options.memetic)
 		{
 			std::cout << "No algorithm specified, nothing to do" << std::endl;
 			return EXIT_SUCCESS;
@@ -710,6 +1104,26 @@ int main(int argc, char* argv[])
 			uscp::problem::check_instances();
 		}
 
+		if(program_options.generate)
+		{
+			if(!generate_instance(program_options))
+			{
+				return EXIT_FAILURE;
+			}
+			LOGGER->info("END");
+			return EXIT_SUCCESS;
+		}
+
+		if(program_options.convert)
+		{
+			if(!convert_instances(program_options))
+			{
+				return EXIT_FAILURE;
+			}
+			LOGGER->info("END");
+			return EXIT_SUCCESS;
+		}
+
 		// Prepare data
 		nlohmann::json data;
 		data["git"]["retrieved_state"] = git_info::retrieved_state;
@@ -720,8 +1134,19 @@ int main(int argc, char* argv[])
 		now_txt << std::put_time(std::localtime(&t), "%FT%TZ");
 		data["date"] = now_txt.str();
 
+		uscp::problem::cache::set_memory_limit(program_options.instances_cache << 20);
+
+		// Random generators, all derived from the seed to allow reproducing the run
+		if(program_options.random_seed)
+		{
+			uscp::random_engine seed_generator(std::random_device{}());
+			program_options.seed = uscp::random_streams(seed_generator).seed();
+		}
+		LOGGER->info("Seed: {}", program_options.seed);
+		data["seed"] = program_options.seed;
+		uscp::random_engine generator = uscp::random_streams(program_options.seed).stream(0);
+
 		// Process instances: generate data
-		uscp::random_engine generator(std::random_device{}());
 		std::optional<std::vector<nlohmann::json>> data_registered_instances =
 		  process_registered_instances(program_options, generator);
 		if(!data_registered_instances)
@@ -741,6 +1166,16 @@ int main(int argc, char* argv[])
 			}
 			data_instances.push_back(std::move(*data_unknown_instances));
 		}
+		if(program_options.sts_order != 0)
+		{
+			std::optional<nlohmann::json> data_sts_instance =
+			  process_generated_sts(program_options, generator);
+			if(!data_sts_instance)
+			{
+				return EXIT_FAILURE;
+			}
+			data_instances.push_back(std::move(*data_sts_instance));
+		}
 		data["instances"] = std::move(data_instances);
 
 		// save data